@@ -35,10 +35,12 @@ const char AppName[] = APP_NAME;
 
 int main(int argc, const char *argv[])
 {
+	tJsonEdit *Edit = NULL;
+	tJsonElement *Value = NULL;
 	tJsonElement Root;
-	tJsonElement Value;
-	tJsonElement *Element;
-	tJsonElement *ChildValue;
+	const char *GetPath = NULL;
+	size_t EditCount = 0;
+	size_t n;
 	tJsonCommentType CommentType = json_CommentLine;
 	tJsonUtfType UtfType = json_Utf8;
 	size_t IndentSize = 3;
@@ -46,9 +48,6 @@ int main(int argc, const char *argv[])
 	int Argument;
 	int Error;
 
-	JsonElementSetUp(&Root);
-	JsonElementSetUp(&Value);
-
 	for (Error = JSONCFG_ERROR_NONE, Argument = 1; (Error == JSONCFG_ERROR_NONE) && (Argument < argc) && (argv[Argument][0] == '-'); Argument++)
 	{
 		if ((argv[Argument][1] == 'c') && ((argv[Argument][2] == 'n') || (argv[Argument][2] == 'l') || (argv[Argument][2] == 'b')) && (argv[Argument][3] == '\0'))
@@ -100,56 +99,91 @@ int main(int argc, const char *argv[])
 		{
 			RequireBOM = true;
 		}
+		else if ((argv[Argument][1] == 'g') && (argv[Argument][2] == 'e') && (argv[Argument][3] == 't') && (argv[Argument][4] == '\0') && (Argument + 1 < argc))
+		{
+			Argument++;
+			GetPath = argv[Argument];
+		}
 		else
 		{
 			Error = JSONCFG_ERROR_BAD_ARGS;
 		}
 	}
 
-	if (Error == JSONCFG_ERROR_NONE)
+	if ((Error == JSONCFG_ERROR_NONE) && (((argc - Argument) % 2) || ((GetPath != NULL) && (Argument < argc))))
+	{
+		Error = JSONCFG_ERROR_BAD_ARGS;
+	}
+
+	if ((Error == JSONCFG_ERROR_NONE) && (GetPath != NULL))
 	{
-		if ((argc - Argument) % 2)
+		JsonElementSetUp(&Root);
+
+		if (!JsonReadFind(&Root, CommentType == json_CommentNone, JsonPathAscii(GetPath), stdin, JSONCFG_BUFFER_SIZE))
 		{
-			Error = JSONCFG_ERROR_BAD_ARGS;
+			Error = JSONCFG_ERROR_READ_STDIN;
 		}
-		else if (!JsonReadFile(&Root, CommentType == json_CommentNone, stdin, JSONCFG_BUFFER_SIZE))
+		else if (JsonElementGetChild(&Root, true) == NULL)
 		{
-			Error = JSONCFG_ERROR_READ_STDIN;
+			Error = JSONCFG_ERROR_NO_PATH;
 		}
+		else if (!JsonWriteFile(&Root, UtfType, RequireBOM, IndentSize, CommentType, stdout, JSONCFG_BUFFER_SIZE))
+		{
+			Error = JSONCFG_ERROR_WRITE_STDOUT;
+		}
+
+		JsonElementCleanUp(&Root);
+
+		return Error;
+	}
 
-		for (; (Error == JSONCFG_ERROR_NONE) && (Argument < argc); Argument = Argument + 2)
+	if (Error == JSONCFG_ERROR_NONE)
+	{
+		Edit = (tJsonEdit *)malloc(((argc - Argument) / 2 + 1) * sizeof(tJsonEdit));
+		Value = (tJsonElement *)malloc(((argc - Argument) / 2 + 1) * sizeof(tJsonElement));
+		if ((Edit == NULL) || (Value == NULL))
 		{
-			Element = JsonElementFind(&Root, JsonPathAscii(argv[Argument]), true);
-			if (Element == NULL)
-			{
-				Error = JSONCFG_ERROR_NO_PATH;
-			}
-			else if (!JsonReadStringAscii(&Value, false, argv[Argument + 1]))
-			{
-				Error = JSONCFG_ERROR_READ_VALUE;
-			}
-			else
-			{
-				ChildValue = JsonElementGetChild(&Value, true);
-				if ((JsonElementGetType(Element) == json_TypeObject) && (JsonElementGetType(ChildValue) == json_TypeObject))
-				{
-					Error = (JsonElementMoveChild(Element, ChildValue) != NULL) ? JSONCFG_ERROR_NONE : JSONCFG_ERROR_SET_VALUE;
-				}
-				else
-				{
-					Error = (JsonElementMoveChild(Element, &Value) != NULL) ? JSONCFG_ERROR_NONE : JSONCFG_ERROR_SET_VALUE;
-				}
-			}
+			Error = JSONCFG_ERROR_BAD_ARGS;
 		}
+	}
+
+	for (; (Error == JSONCFG_ERROR_NONE) && (Argument < argc); Argument = Argument + 2, EditCount++)
+	{
+		JsonElementSetUp(&Value[EditCount]);
+		JsonEditSetUp(&Edit[EditCount], JsonPathAscii(argv[Argument]), JsonReadStringAscii(&Value[EditCount], false, argv[Argument + 1]) ? &Value[EditCount] : NULL);
+	}
 
-		if ((Error == JSONCFG_ERROR_NONE) && !JsonWriteFile(&Root, UtfType, RequireBOM, IndentSize, CommentType, stdout, JSONCFG_BUFFER_SIZE))
+	if ((Error == JSONCFG_ERROR_NONE) && !JsonStreamFile(Edit, EditCount, stdin, UtfType, RequireBOM, IndentSize, CommentType, stdout, JSONCFG_BUFFER_SIZE, &n))
+	{
+		if (n > EditCount)
+		{
+			Error = ferror(stdout) ? JSONCFG_ERROR_WRITE_STDOUT : JSONCFG_ERROR_READ_STDIN;
+		}
+		else if (n == EditCount)
 		{
 			Error = JSONCFG_ERROR_WRITE_STDOUT;
 		}
+		else if (Edit[n].State == json_EditNoPath)
+		{
+			Error = JSONCFG_ERROR_NO_PATH;
+		}
+		else if (Edit[n].Value == NULL)
+		{
+			Error = JSONCFG_ERROR_READ_VALUE;
+		}
+		else
+		{
+			Error = JSONCFG_ERROR_SET_VALUE;
+		}
+	}
+
+	for (n = 0; n < EditCount; n++)
+	{
+		JsonElementCleanUp(&Value[n]);
 	}
 
-	JsonElementCleanUp(&Value);
-	JsonElementCleanUp(&Root);
+	free(Edit);
+	free(Value);
 
 	return Error;
 }
@@ -0,0 +1,93 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <time.h>
+#include "bench.h"
+#include "json_stats.h"
+
+
+static double BenchGetTime(void)
+{
+	struct timespec Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+
+	return (double)Time.tv_sec + (double)Time.tv_nsec / 1e9;
+}
+
+
+void BenchGetAllocation(tBenchAllocation *Allocation)
+{
+	tJsonStats Stats;
+	size_t n;
+
+	JsonStatsGet(&Stats);
+
+	Allocation->Count = 0;
+	Allocation->Size = 0;
+
+	for (n = 0; n < json_StatsSubsystemCount; n++)
+	{
+		Allocation->Count = Allocation->Count + Stats.Allocation[n].Malloc + Stats.Allocation[n].Realloc;
+		Allocation->Size = Allocation->Size + Stats.Allocation[n].Bytes;
+	}
+}
+
+
+void BenchRun(tBenchFunction Function, void *Context, tBenchResult *Result)
+{
+	tBenchAllocation Allocation;
+	tBenchAllocation End;
+	double Start;
+
+	Result->Repeat = 0;
+	Result->Seconds = 0;
+	Result->Allocation.Count = 0;
+	Result->Allocation.Size = 0;
+	Result->Success = Function(Context);
+
+	BenchGetAllocation(&Allocation);
+
+	Start = BenchGetTime();
+
+	while (Result->Success && (Result->Seconds < BENCH_MIN_TIME))
+	{
+		Result->Success = Function(Context);
+		Result->Repeat++;
+
+		if (((Result->Repeat & (Result->Repeat - 1)) == 0) || ((Result->Repeat % 1024) == 0))
+		{
+			Result->Seconds = BenchGetTime() - Start;
+		}
+	}
+
+	BenchGetAllocation(&End);
+
+	Result->Allocation.Count = End.Count - Allocation.Count;
+	Result->Allocation.Size = End.Size - Allocation.Size;
+}
+
+
+void BenchReportHeading(FILE *Stream)
+{
+	fprintf(Stream, "Document,Function,Bytes,Calls,Seconds,MBPerSecond,CallsPerSecond,AllocationsPerCall,AllocatedBytesPerCall,Result\n");
+}
+
+
+void BenchReport(FILE *Stream, const tBenchResult *Result)
+{
+	double Calls = (Result->Repeat > 0) ? (double)Result->Repeat : 1;
+	double Seconds = (Result->Seconds > 0) ? Result->Seconds : 1;
+
+	fprintf(Stream, "\"%s\",\"%s\",%zu,%zu,%.6f,%.3f,%.1f,%.2f,%.1f,%s\n",
+	        Result->Document,
+	        Result->Function,
+	        Result->Length,
+	        Result->Repeat,
+	        Result->Seconds,
+	        (double)Result->Length * Result->Repeat / Seconds / 1e6,
+	        Result->Repeat / Seconds,
+	        Result->Allocation.Count / Calls,
+	        Result->Allocation.Size / Calls,
+	        Result->Success ? "PASS" : "FAIL");
+}
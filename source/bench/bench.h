@@ -0,0 +1,86 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+
+/**
+ * @brief The minimum time (in seconds) that each benchmark is run for
+ */
+#define BENCH_MIN_TIME 0.5
+
+
+/**
+ * @brief Type used for a count of memory allocations
+ */
+typedef struct
+{
+	size_t Count; /**< The number of memory allocations and reallocations made by the library */
+	size_t Size;  /**< The total number of bytes that were requested */
+} tBenchAllocation;
+
+
+/**
+ * @brief Type used for a benchmark function
+ * @param Context The benchmark context
+ * @return A true value is returned if the function was successful
+ * @return A false value is returned if the function failed (the benchmark is stopped)
+ */
+typedef bool (* tBenchFunction)(void *Context);
+
+
+/**
+ * @brief Type used for a benchmark result
+ */
+typedef struct
+{
+	const char      *Document;   /**< The name of the document that was used */
+	const char      *Function;   /**< The name of the function that was benchmarked */
+	size_t           Length;     /**< The number of bytes that are processed by each call of the function (zero if not applicable) */
+	size_t           Repeat;     /**< The number of times that the function was called */
+	double           Seconds;    /**< The total time taken by the calls (in seconds) */
+	tBenchAllocation Allocation; /**< The memory allocations made by the calls */
+	bool             Success;    /**< Indicates if all the calls were successful */
+} tBenchResult;
+
+
+/**
+ * @brief Gets the memory allocations made by the library since the program started
+ * @param Allocation Updated with the allocations
+ * @return None
+ * @note The allocations are counted by the library statistics (see \a `JsonStatsGet()`) - the makefile builds the benchmark application with \a `JSON_STATS` defined.
+ */
+void BenchGetAllocation(tBenchAllocation *Allocation);
+
+
+/**
+ * @brief Runs a benchmark
+ * @param Function The function to benchmark
+ * @param Context  The context to pass to the function
+ * @param Result   The result of the benchmark (the \a `Document`, \a `Function` and \a `Length` members should already be set)
+ * @return None
+ * @note The function is called once before the benchmark is timed and then called repeatedly for at least \a `BENCH_MIN_TIME` seconds.
+ */
+void BenchRun(tBenchFunction Function, void *Context, tBenchResult *Result);
+
+
+/**
+ * @brief Writes the heading line of the benchmark results (comma separated values)
+ * @param Stream The file to write the heading to
+ * @return None
+ */
+void BenchReportHeading(FILE *Stream);
+
+
+/**
+ * @brief Writes a benchmark result (comma separated values)
+ * @param Stream The file to write the result to
+ * @param Result The benchmark result
+ * @return None
+ */
+void BenchReport(FILE *Stream, const tBenchResult *Result);
+
+
+#endif
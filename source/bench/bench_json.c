@@ -0,0 +1,393 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "json.h"
+#include "bench.h"
+
+
+#define BENCH_JSON_BUFFER_SIZE      65536
+#define BENCH_JSON_FILE_BUFFER_SIZE 4096
+
+#define BENCH_JSON_DEEP_COUNT  64
+#define BENCH_JSON_DEEP_DEPTH  256
+#define BENCH_JSON_WIDE_COUNT  100000
+#define BENCH_JSON_LONG_COUNT  1000
+#define BENCH_JSON_LONG_LENGTH 2000
+#define BENCH_JSON_NOTE_COUNT  20000
+
+
+/**
+ * @brief Type used for building the content of a benchmark document
+ */
+typedef struct
+{
+	uint8_t *Content; /**< The null terminated UTF-8 encoded content */
+	size_t   Length;  /**< The length of the content (in bytes) */
+	size_t   Size;    /**< The number of bytes that have been allocated for the content */
+} tBenchJsonContent;
+
+
+/**
+ * @brief Type used for a benchmark document
+ */
+typedef struct
+{
+	const char       *Name;        /**< The document name */
+	tJsonUtfType      UtfType;     /**< The encoding that is used for the document file, formatting and writing */
+	tBenchJsonContent Content;     /**< The UTF-8 encoded content of the document */
+	tBenchJsonContent Path;        /**< The path of an element in the document (for finding) */
+	tJsonElement      Root;        /**< The document elements */
+	tJsonElement      ReadRoot;    /**< The elements that the document is read to */
+	tJsonElement      RecycleRoot; /**< The elements that the document is read to (recycling the elements of the previous read) */
+	FILE             *File;        /**< The document file (encoded using \a `UtfType`) */
+	size_t            FileLength;  /**< The length of the document file (in bytes) */
+	FILE             *WriteFile;   /**< The file that the document is written to */
+	size_t            WriteLength; /**< The length of the document when it is written or formatted (in bytes) */
+	uint8_t          *Buffer;      /**< The buffer that the document is formatted to */
+} tBenchJsonDocument;
+
+
+static bool BenchJsonAdd(tBenchJsonContent *Content, const char *Format, ...)
+{
+	uint8_t *NewContent;
+	va_list Arguments;
+	int Length;
+
+	va_start(Arguments, Format);
+	Length = vsnprintf(NULL, 0, Format, Arguments);
+	va_end(Arguments);
+
+	if (Length < 0)
+	{
+		return false;
+	}
+
+	if (Content->Length + Length + 1 > Content->Size)
+	{
+		Content->Size = 2 * (Content->Length + Length + 1);
+		NewContent = (uint8_t *)realloc(Content->Content, Content->Size);
+		if (NewContent == NULL)
+		{
+			return false;
+		}
+		Content->Content = NewContent;
+	}
+
+	va_start(Arguments, Format);
+	vsnprintf((char *)&Content->Content[Content->Length], Length + 1, Format, Arguments);
+	va_end(Arguments);
+
+	Content->Length = Content->Length + Length;
+
+	return true;
+}
+
+
+static bool BenchJsonCreateDeep(tBenchJsonDocument *Document)
+{
+	bool ok = BenchJsonAdd(&Document->Content, "{");
+	size_t n;
+	size_t m;
+
+	for (n = 0; ok && (n < BENCH_JSON_DEEP_COUNT); n++)
+	{
+		ok = BenchJsonAdd(&Document->Content, "%s\"n%zu\": ", (n > 0) ? ", " : "", n);
+		for (m = 0; ok && (m < BENCH_JSON_DEEP_DEPTH); m++)
+		{
+			ok = BenchJsonAdd(&Document->Content, "{\"b\": [%zu, true], \"a\": ", m);
+		}
+		ok = ok && BenchJsonAdd(&Document->Content, "null");
+		for (m = 0; ok && (m < BENCH_JSON_DEEP_DEPTH); m++)
+		{
+			ok = BenchJsonAdd(&Document->Content, "}");
+		}
+	}
+
+	ok = ok && BenchJsonAdd(&Document->Content, "}") && BenchJsonAdd(&Document->Path, "/n%d", BENCH_JSON_DEEP_COUNT - 1);
+	for (m = 0; ok && (m < BENCH_JSON_DEEP_DEPTH); m++)
+	{
+		ok = BenchJsonAdd(&Document->Path, "/a");
+	}
+
+	return ok && BenchJsonAdd(&Document->Path, ":null");
+}
+
+
+static bool BenchJsonCreateWide(tBenchJsonDocument *Document)
+{
+	bool ok = BenchJsonAdd(&Document->Content, "{");
+	size_t n;
+
+	for (n = 0; ok && (n < BENCH_JSON_WIDE_COUNT); n++)
+	{
+		ok = ((n % 2) == 0) ? BenchJsonAdd(&Document->Content, "%s\"k%zu\": %zu", (n > 0) ? ", " : "", n, n) : BenchJsonAdd(&Document->Content, ", \"k%zu\": \"value %zu\"", n, n);
+	}
+
+	return ok && BenchJsonAdd(&Document->Content, "}") && BenchJsonAdd(&Document->Path, "/k%d", BENCH_JSON_WIDE_COUNT - 1);
+}
+
+
+static bool BenchJsonCreateLong(tBenchJsonDocument *Document)
+{
+	static const char *Text[] = { "lorem ipsum dolor sit amet ", "\\\"quoted\\\" ", "line\\n", "caf\xC3\xA9 ", "\\u00e9\\u20ac " };
+	bool ok = BenchJsonAdd(&Document->Content, "{");
+	size_t Length;
+	size_t n;
+	size_t m;
+
+	for (n = 0; ok && (n < BENCH_JSON_LONG_COUNT); n++)
+	{
+		ok = BenchJsonAdd(&Document->Content, "%s\"s%zu\": \"", (n > 0) ? ", " : "", n);
+		for (Length = 0, m = n; ok && (Length < BENCH_JSON_LONG_LENGTH); Length = Length + strlen(Text[m % 5]), m = m + ((m % 7) == 0) + 1)
+		{
+			ok = BenchJsonAdd(&Document->Content, "%s", Text[m % 5]);
+		}
+		ok = ok && BenchJsonAdd(&Document->Content, "\"");
+	}
+
+	return ok && BenchJsonAdd(&Document->Content, "}") && BenchJsonAdd(&Document->Path, "/s%d", BENCH_JSON_LONG_COUNT - 1);
+}
+
+
+static bool BenchJsonCreateNote(tBenchJsonDocument *Document)
+{
+	bool ok = BenchJsonAdd(&Document->Content, "// A document with lots of comments\n{\n");
+	size_t n;
+
+	for (n = 0; ok && (n < BENCH_JSON_NOTE_COUNT); n++)
+	{
+		ok = BenchJsonAdd(&Document->Content, "   /* The setting for item %zu\n      (a block comment) */\n   \"c%zu\": %zu // a line comment\n", n, n, n);
+		ok = ok && ((n + 1 == BENCH_JSON_NOTE_COUNT) || BenchJsonAdd(&Document->Content, "   ,\n"));
+	}
+
+	return ok && BenchJsonAdd(&Document->Content, "}\n") && BenchJsonAdd(&Document->Path, "/c%d", BENCH_JSON_NOTE_COUNT - 1);
+}
+
+
+static bool BenchJsonSetUpDocument(tBenchJsonDocument *Document, const char *Name, tJsonUtfType UtfType, bool (* Create)(tBenchJsonDocument *Document))
+{
+	bool ok;
+
+	memset(Document, 0, sizeof(*Document));
+	Document->Name = Name;
+	Document->UtfType = UtfType;
+	JsonElementSetUp(&Document->Root);
+	JsonElementSetUp(&Document->ReadRoot);
+
+	ok = JsonElementSetUpRecycle(&Document->RecycleRoot) && Create(Document) && JsonReadStringUtf8(&Document->Root, false, Document->Content.Content);
+
+	Document->File = tmpfile();
+	Document->WriteFile = tmpfile();
+	Document->Buffer = (uint8_t *)malloc(BENCH_JSON_BUFFER_SIZE);
+
+	ok = ok && (Document->File != NULL) && (Document->WriteFile != NULL) && (Document->Buffer != NULL);
+
+	if (ok && (UtfType == json_Utf8))
+	{
+		ok = fwrite(Document->Content.Content, 1, Document->Content.Length, Document->File) == Document->Content.Length;
+	}
+	else if (ok)
+	{
+		ok = JsonWriteFile(&Document->Root, UtfType, true, 3, json_CommentLine, Document->File, BENCH_JSON_FILE_BUFFER_SIZE);
+	}
+
+	if (ok)
+	{
+		Document->FileLength = (size_t)ftell(Document->File);
+		ok = JsonWriteFile(&Document->Root, UtfType, false, 3, json_CommentLine, Document->WriteFile, BENCH_JSON_FILE_BUFFER_SIZE);
+		Document->WriteLength = (size_t)ftell(Document->WriteFile);
+	}
+
+	return ok;
+}
+
+
+static void BenchJsonCleanUpDocument(tBenchJsonDocument *Document)
+{
+	JsonElementCleanUp(&Document->Root);
+	JsonElementCleanUp(&Document->ReadRoot);
+	JsonElementCleanUp(&Document->RecycleRoot);
+	if (Document->File != NULL)
+	{
+		fclose(Document->File);
+	}
+	if (Document->WriteFile != NULL)
+	{
+		fclose(Document->WriteFile);
+	}
+	free(Document->Buffer);
+	free(Document->Content.Content);
+	free(Document->Path.Content);
+}
+
+
+static bool BenchJsonReadStringUtf8(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+
+	return JsonReadStringUtf8(&Document->ReadRoot, false, Document->Content.Content);
+}
+
+
+static bool BenchJsonReadStringRecycle(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+
+	return JsonReadStringUtf8(&Document->RecycleRoot, false, Document->Content.Content);
+}
+
+
+static bool BenchJsonEventParse(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+	tJsonEventParse Parse;
+	tJsonEvent Event;
+	size_t Offset = 0;
+	int State;
+
+	JsonEventSetUp(&Parse, false);
+
+	while ((State = JsonEventNextUtf8(&Parse, Document->Content.Content, Document->Content.Length + 1, &Offset, &Event)) == JSON_EVENT_AVAILABLE)
+	{
+	}
+
+	JsonEventCleanUp(&Parse);
+
+	return State == JSON_EVENT_COMPLETE;
+}
+
+
+static bool BenchJsonReadFile(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+
+	return (fseek(Document->File, 0, SEEK_SET) == 0) && JsonReadFile(&Document->ReadRoot, false, Document->File, BENCH_JSON_FILE_BUFFER_SIZE);
+}
+
+
+static bool BenchJsonWriteFile(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+
+	return (fseek(Document->WriteFile, 0, SEEK_SET) == 0) && JsonWriteFile(&Document->Root, Document->UtfType, false, 3, json_CommentLine, Document->WriteFile, BENCH_JSON_FILE_BUFFER_SIZE);
+}
+
+
+static bool BenchJsonFormat(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+	tJsonFormat Format;
+	size_t Offset;
+	int State;
+
+	JsonFormatSetUpIndent(&Format, 3, json_CommentLine, &Document->Root);
+
+	do
+	{
+		Offset = 0;
+		State = JsonFormat(&Format, Document->UtfType, Document->Buffer, BENCH_JSON_BUFFER_SIZE, &Offset);
+	}
+	while (State == JSON_FORMAT_INCOMPLETE);
+
+	JsonFormatCleanUp(&Format);
+
+	return State == JSON_FORMAT_COMPLETE;
+}
+
+
+static bool BenchJsonFind(void *Context)
+{
+	tBenchJsonDocument *Document = (tBenchJsonDocument *)Context;
+
+	return JsonElementFind(&Document->Root, JsonPathUtf8(Document->Path.Content), false) != NULL;
+}
+
+
+static void BenchJsonRun(FILE *Stream, tBenchJsonDocument *Document, const char *Function, tBenchFunction BenchFunction, size_t Length)
+{
+	tBenchResult Result;
+
+	Result.Document = Document->Name;
+	Result.Function = Function;
+	Result.Length = Length;
+
+	BenchRun(BenchFunction, Document, &Result);
+
+	BenchReport(Stream, &Result);
+	if (Stream != stdout)
+	{
+		BenchReport(stdout, &Result);
+	}
+}
+
+
+int main(int argc, const char *argv[])
+{
+	static const struct
+	{
+		const char  *Name;
+		tJsonUtfType UtfType;
+		bool       (* Create)(tBenchJsonDocument *Document);
+	} Documents[] =
+	{
+		{ "deep",       json_Utf8,    BenchJsonCreateDeep },
+		{ "wide",       json_Utf8,    BenchJsonCreateWide },
+		{ "long",       json_Utf8,    BenchJsonCreateLong },
+		{ "comment",    json_Utf8,    BenchJsonCreateNote },
+		{ "wide-utf16", json_Utf16le, BenchJsonCreateWide }
+	};
+	tBenchJsonDocument Document;
+	FILE *Stream = stdout;
+	size_t n;
+	int Error = 0;
+
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [results file]\n", argv[0]);
+		return -1;
+	}
+
+	if (argc == 2)
+	{
+		Stream = fopen(argv[1], "w");
+		if (Stream == NULL)
+		{
+			fprintf(stderr, "Unable to open \"%s\"\n", argv[1]);
+			return -1;
+		}
+		BenchReportHeading(Stream);
+	}
+
+	BenchReportHeading(stdout);
+
+	for (n = 0; n < sizeof(Documents) / sizeof(Documents[0]); n++)
+	{
+		if (!BenchJsonSetUpDocument(&Document, Documents[n].Name, Documents[n].UtfType, Documents[n].Create))
+		{
+			fprintf(stderr, "Unable to set up the \"%s\" document\n", Documents[n].Name);
+			Error = -1;
+		}
+		else
+		{
+			if (Document.UtfType == json_Utf8)
+			{
+				BenchJsonRun(Stream, &Document, "JsonReadStringUtf8", BenchJsonReadStringUtf8, Document.Content.Length);
+				BenchJsonRun(Stream, &Document, "JsonReadStringUtf8 (recycle)", BenchJsonReadStringRecycle, Document.Content.Length);
+				BenchJsonRun(Stream, &Document, "JsonEventNextUtf8", BenchJsonEventParse, Document.Content.Length);
+			}
+			BenchJsonRun(Stream, &Document, "JsonReadFile", BenchJsonReadFile, Document.FileLength);
+			BenchJsonRun(Stream, &Document, "JsonWriteFile", BenchJsonWriteFile, Document.WriteLength);
+			BenchJsonRun(Stream, &Document, "JsonFormat", BenchJsonFormat, Document.WriteLength);
+			BenchJsonRun(Stream, &Document, "JsonElementFind", BenchJsonFind, 0);
+		}
+
+		BenchJsonCleanUpDocument(&Document);
+	}
+
+	if (Stream != stdout)
+	{
+		fclose(Stream);
+	}
+
+	return Error;
+}
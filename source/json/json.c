@@ -1,5 +1,14 @@
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define JSON_READ_MAP
+#endif
+
 #include <fcntl.h>
 #include <string.h>
+#ifdef JSON_READ_MAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "json_utf.h"
 #include "json.h"
 
@@ -7,6 +16,80 @@
 #define JSON_BUFFER_SIZE(n) (((n) > JSON_FORMAT_MIN_SIZE) ? (n) : JSON_FORMAT_MIN_SIZE)
 
 
+static int JsonReadFileParseContent(tJsonParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Length, size_t *Offset)
+{
+	tJsonElement *Element;
+	int State;
+
+	do
+	{
+		State = JsonParse(Parse, UtfType, Content, Length, Offset);
+	}
+	while (State == JSON_PARSE_REPORTED);
+
+	Element = Parse->Element;
+	if ((State == JSON_PARSE_INCOMPLETE) && Parse->ViewContent && (Element != NULL) && !JsonParseIsNameComplete(Parse, Element) && JsonStringIsView(&Element->Name) && !JsonStringReserve(&Element->Name, JsonStringGetLength(&Element->Name)))
+	{
+		State = JSON_PARSE_ERROR;
+	}
+
+	return State;
+}
+
+
+#ifdef JSON_READ_MAP
+static bool JsonReadFileMap(tJsonParse *Parse, FILE *Stream, int *State)
+{
+	tJsonUtfType UtfType;
+	struct stat Stat;
+	uint8_t *Map;
+	uint8_t Buffer[JSON_UTF_MAX_SIZE];
+	size_t Length;
+	size_t Offset;
+	long Position;
+
+	Position = ftell(Stream);
+	if ((Position < 0) || (fstat(fileno(Stream), &Stat) != 0) || !S_ISREG(Stat.st_mode) || (Stat.st_size <= Position) || ((uintmax_t)Stat.st_size > SIZE_MAX))
+	{
+		return false;
+	}
+
+	Length = (size_t)Stat.st_size;
+	Map = (uint8_t *)mmap(NULL, Length, PROT_READ, MAP_PRIVATE, fileno(Stream), 0);
+	if (Map == MAP_FAILED)
+	{
+		return false;
+	}
+
+	posix_madvise(Map, Length, POSIX_MADV_SEQUENTIAL);
+
+	Offset = (size_t)Position;
+	Offset = Offset + JsonUtfGetType(&Map[Offset], Length - Offset, &UtfType);
+
+	*State = JsonReadFileParseContent(Parse, UtfType, Map, Length, &Offset);
+	if (*State == JSON_PARSE_INCOMPLETE)
+	{
+		if (Offset == Length)
+		{
+			Length = JsonUtfEncode(UtfType, Buffer, sizeof(Buffer), 0, '\0');
+			Offset = 0;
+			*State = JsonReadFileParseContent(Parse, UtfType, Buffer, Length, &Offset);
+		}
+		else
+		{
+			*State = JSON_PARSE_ERROR;
+		}
+	}
+
+	munmap(Map, (size_t)Stat.st_size);
+
+	fseek(Stream, 0, SEEK_END);
+
+	return true;
+}
+#endif
+
+
 bool JsonReadStringAscii(tJsonElement *Root, bool StripComments, const char *String)
 {
 	return JsonReadStringUtf8(Root, StripComments, (const uint8_t *)String);
@@ -28,17 +111,221 @@ bool JsonReadStringUtf8(tJsonElement *Root, bool StripComments, const uint8_t *S
 }
 
 
-bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t BufferSize)
+bool JsonReadStringUtf8View(tJsonElement *Root, bool StripComments, const uint8_t *String)
 {
-	tJsonUtfType UtfType;
 	tJsonParse Parse;
+	int State;
+
+	JsonParseSetUpView(&Parse, StripComments, Root);
+
+	State = JsonParse(&Parse, json_Utf8, String, (String != NULL) ? strlen((const char *)String) + 1 : 0, NULL);
+
+	JsonParseCleanUp(&Parse);
+
+	return State == JSON_PARSE_COMPLETE;
+}
+
+
+static int JsonReadFileParse(tJsonParse *Parse, FILE *Stream, size_t BufferSize)
+{
+	tJsonUtfType UtfType;
 	uint8_t Buffer[JSON_BUFFER_SIZE(BufferSize)];
 	size_t Length;
 	size_t Offset;
 	int State = JSON_PARSE_INCOMPLETE;
 
+#ifdef __WIN32__
+	setmode(fileno(Stream), O_BINARY);
+#endif
+
+#ifdef JSON_READ_MAP
+	if (JsonReadFileMap(Parse, Stream, &State))
+	{
+		return State;
+	}
+#endif
+
+	Length = fread(Buffer, 1, JSON_BUFFER_SIZE(BufferSize), Stream);
+
+	Offset = JsonUtfGetType(Buffer, Length, &UtfType);
+
+	while ((State == JSON_PARSE_INCOMPLETE) && (Length > 0))
+	{
+		State = JsonReadFileParseContent(Parse, UtfType, Buffer, Length, &Offset);
+		if (State != JSON_PARSE_ERROR)
+		{
+			if (Offset != 0)
+			{
+				memmove(Buffer, &Buffer[Offset], Length - Offset);
+				Offset = Length - Offset;
+				Length = Offset + fread(&Buffer[Offset], 1, JSON_BUFFER_SIZE(BufferSize) - Offset, Stream);
+				Offset = 0;
+			}
+			else
+			{
+				State = JSON_PARSE_ERROR;
+			}
+		}
+	}
+
+	if (State == JSON_PARSE_INCOMPLETE)
+	{
+		Length = JsonUtfEncode(UtfType, Buffer, JSON_BUFFER_SIZE(BufferSize), 0, '\0');
+		Offset = 0;
+		State = JsonReadFileParseContent(Parse, UtfType, Buffer, Length, &Offset);
+	}
+
+	return State;
+}
+
+
+bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t BufferSize)
+{
+	tJsonParse Parse;
+	int State;
+
 	JsonParseSetUp(&Parse, StripComments, Root);
 
+	State = JsonReadFileParse(&Parse, Stream, BufferSize);
+
+	JsonParseCleanUp(&Parse);
+
+	return State == JSON_PARSE_COMPLETE;
+}
+
+
+bool JsonReadFileCallback(tJsonParseCallback Callback, void *Context, bool StripComments, FILE *Stream, size_t BufferSize)
+{
+	tJsonElement Root;
+	tJsonParse Parse;
+	int State;
+
+	JsonElementSetUp(&Root);
+	JsonParseSetUpCallback(&Parse, StripComments, &Root, Callback, Context);
+
+	State = JsonReadFileParse(&Parse, Stream, BufferSize);
+
+	JsonParseCleanUp(&Parse);
+	JsonElementCleanUp(&Root);
+
+	return State == JSON_PARSE_COMPLETE;
+}
+
+
+bool JsonReadFileFilter(tJsonElement *Root, bool StripComments, const tJsonPath *Path, size_t PathCount, FILE *Stream, size_t BufferSize)
+{
+	tJsonFilter Filter;
+	tJsonParse Parse;
+	int State = JSON_PARSE_ERROR;
+
+	JsonFilterSetUp(&Filter, Path, PathCount);
+
+	if (JsonParseSetUpFilter(&Parse, StripComments, Root, &Filter))
+	{
+		State = JsonReadFileParse(&Parse, Stream, BufferSize);
+	}
+
+	JsonParseCleanUp(&Parse);
+	JsonFilterCleanUp(&Filter);
+
+	return State == JSON_PARSE_COMPLETE;
+}
+
+
+static size_t JsonReadFindScope(tJsonPath Path, bool *IsSelector)
+{
+	tJsonPath Component;
+	tJsonType ComponentType;
+	ptrdiff_t Position;
+	size_t Offset;
+	size_t Length;
+
+	for (Offset = 0; Offset < Path.Length; Offset = Offset + Length)
+	{
+		Length = JsonPathGetComponent(JsonPathRight(Path, Offset), &ComponentType, &Component);
+		if (Length == 0)
+		{
+			break;
+		}
+		else if (ComponentType == json_TypeArray)
+		{
+			*IsSelector = !JsonPathGetPosition(Component, &Position);
+			if (*IsSelector || (Position < 0))
+			{
+				return Offset;
+			}
+		}
+	}
+
+	*IsSelector = false;
+
+	return Path.Length;
+}
+
+
+static tJsonElement *JsonReadFindElement(const tJsonParse *Parse, tJsonElement *Root, tJsonPath Path, size_t ScopeOffset, bool IsSelector)
+{
+	tJsonElement *Element;
+	tJsonElement *Scope = NULL;
+	tJsonElement *Parsed;
+
+	Element = JsonElementFind(Root, Path, false);
+	if ((Element != NULL) && JsonParseIsComplete(Parse, Element) && (ScopeOffset < Path.Length))
+	{
+		Scope = (ScopeOffset != 0) ? JsonElementFind(Root, JsonPathLeft(Path, ScopeOffset), false) : Root;
+		if ((Scope != NULL) && ((Scope->Type == json_TypeRoot) || (Scope->Type == json_TypeKey)))
+		{
+			Scope = JsonElementGetChild(Scope, true);
+		}
+
+		if (IsSelector)
+		{
+			for (Parsed = Element; (Parsed != NULL) && (Parsed->Parent != Scope); Parsed = Parsed->Parent)
+				;
+			Scope = Parsed;
+		}
+
+		if ((Scope == NULL) || !JsonParseIsComplete(Parse, Scope))
+		{
+			Element = NULL;
+		}
+	}
+	else if ((Element != NULL) && !JsonParseIsComplete(Parse, Element))
+	{
+		Element = NULL;
+	}
+
+	for (Parsed = Parse->Element; Parsed != NULL; Parsed = Parsed->Parent)
+	{
+		JsonElementClearIndex(Parsed);
+	}
+
+	return Element;
+}
+
+
+bool JsonReadFind(tJsonElement *Root, bool StripComments, tJsonPath Path, FILE *Stream, size_t BufferSize)
+{
+	tJsonUtfType UtfType;
+	tJsonFilter Filter;
+	tJsonParse Parse;
+	tJsonElement *Element = NULL;
+	uint8_t Buffer[JSON_BUFFER_SIZE(BufferSize)];
+	size_t ScopeOffset;
+	size_t Length;
+	size_t Offset;
+	bool IsSelector;
+	int State = JSON_PARSE_ERROR;
+
+	ScopeOffset = JsonReadFindScope(Path, &IsSelector);
+
+	JsonFilterSetUp(&Filter, &Path, 1);
+
+	if (JsonParseSetUpFilter(&Parse, StripComments, Root, &Filter))
+	{
+		State = JSON_PARSE_INCOMPLETE;
+	}
+
 #ifdef __WIN32__
 	setmode(fileno(Stream), O_BINARY);
 #endif
@@ -47,10 +334,15 @@ bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t B
 
 	Offset = JsonUtfGetType(Buffer, Length, &UtfType);
 
-	while ((State == JSON_PARSE_INCOMPLETE) && (Length > 0))
+	while ((State == JSON_PARSE_INCOMPLETE) && (Element == NULL) && (Length > 0))
 	{
 		State = JsonParse(&Parse, UtfType, Buffer, Length, &Offset);
 		if (State != JSON_PARSE_ERROR)
+		{
+			Element = JsonReadFindElement(&Parse, Root, Path, ScopeOffset, IsSelector);
+		}
+
+		if ((State == JSON_PARSE_INCOMPLETE) && (Element == NULL))
 		{
 			if (Offset != 0)
 			{
@@ -66,15 +358,136 @@ bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t B
 		}
 	}
 
-	if (State == JSON_PARSE_INCOMPLETE)
+	if ((State == JSON_PARSE_INCOMPLETE) && (Element == NULL))
 	{
 		Length = JsonUtfEncode(UtfType, Buffer, JSON_BUFFER_SIZE(BufferSize), 0, '\0');
 		State = JsonParse(&Parse, UtfType, Buffer, Length, NULL);
+		if (State == JSON_PARSE_COMPLETE)
+		{
+			Element = JsonReadFindElement(&Parse, Root, Path, ScopeOffset, IsSelector);
+		}
 	}
 
 	JsonParseCleanUp(&Parse);
+	JsonFilterCleanUp(&Filter);
 
-	return State == JSON_PARSE_COMPLETE;
+	if ((State != JSON_PARSE_ERROR) && (Element != NULL))
+	{
+		JsonElementExtract(Root, Element);
+	}
+	else
+	{
+		JsonElementClear(Root);
+	}
+
+	return State != JSON_PARSE_ERROR;
+}
+
+
+bool JsonReadFileEvents(tJsonEventCallback Callback, void *Context, bool StripComments, FILE *Stream, size_t BufferSize)
+{
+	tJsonUtfType UtfType;
+	tJsonEventParse Parse;
+	uint8_t Buffer[JSON_BUFFER_SIZE(BufferSize)];
+	size_t Length;
+	size_t Offset;
+	int State = JSON_EVENT_INCOMPLETE;
+
+	JsonEventSetUp(&Parse, StripComments);
+
+#ifdef __WIN32__
+	setmode(fileno(Stream), O_BINARY);
+#endif
+
+	Length = fread(Buffer, 1, JSON_BUFFER_SIZE(BufferSize), Stream);
+
+	Offset = JsonUtfGetType(Buffer, Length, &UtfType);
+
+	while ((State == JSON_EVENT_INCOMPLETE) && (Length > 0))
+	{
+		State = JsonEventParse(&Parse, UtfType, Buffer, Length, &Offset, Callback, Context);
+		if (State == JSON_EVENT_INCOMPLETE)
+		{
+			if (Offset != 0)
+			{
+				memmove(Buffer, &Buffer[Offset], Length - Offset);
+				Offset = Length - Offset;
+				Length = Offset + fread(&Buffer[Offset], 1, JSON_BUFFER_SIZE(BufferSize) - Offset, Stream);
+				Offset = 0;
+			}
+			else
+			{
+				State = JSON_EVENT_ERROR;
+			}
+		}
+	}
+
+	if (State == JSON_EVENT_INCOMPLETE)
+	{
+		Length = JsonUtfEncode(UtfType, Buffer, JSON_BUFFER_SIZE(BufferSize), 0, '\0');
+		State = JsonEventParse(&Parse, UtfType, Buffer, Length, NULL, Callback, Context);
+	}
+
+	JsonEventCleanUp(&Parse);
+
+	return State == JSON_EVENT_COMPLETE;
+}
+
+
+bool JsonReadFileRecords(tJsonRecordCallback Callback, void *Context, bool StripComments, bool Unordered, size_t ThreadCount, FILE *Stream, size_t BufferSize)
+{
+	tJsonUtfType UtfType;
+	tJsonRecordParse Record;
+	uint8_t Buffer[JSON_BUFFER_SIZE(BufferSize)];
+	size_t Length;
+	size_t Offset;
+	bool ok;
+
+	ok = JsonRecordSetUp(&Record, ThreadCount, StripComments, Unordered, Callback, Context);
+
+#ifdef __WIN32__
+	setmode(fileno(Stream), O_BINARY);
+#endif
+
+	Length = fread(Buffer, 1, JSON_BUFFER_SIZE(BufferSize), Stream);
+
+	Offset = JsonUtfGetType(Buffer, Length, &UtfType);
+	if ((UtfType == json_Utf16be) || (UtfType == json_Utf16le))
+	{
+		ok = false;
+	}
+
+	while (ok && (Length > 0))
+	{
+		ok = JsonRecordRead(&Record, &Buffer[Offset], Length - Offset);
+		Length = fread(Buffer, 1, JSON_BUFFER_SIZE(BufferSize), Stream);
+		Offset = 0;
+	}
+
+	ok = ok && JsonRecordFinish(&Record);
+
+	JsonRecordCleanUp(&Record);
+
+	return ok;
+}
+
+
+bool JsonReadPath(tJsonElement *Root, bool StripComments, const char *Path, size_t BufferSize)
+{
+	FILE *Stream;
+	bool ok;
+
+	Stream = (Path != NULL) ? fopen(Path, "rb") : NULL;
+	if (Stream == NULL)
+	{
+		return false;
+	}
+
+	ok = JsonReadFile(Root, StripComments, Stream, BufferSize);
+
+	fclose(Stream);
+
+	return ok;
 }
 
 
@@ -118,3 +531,78 @@ bool JsonWriteFile(tJsonElement *Root, tJsonUtfType UtfType, bool RequireBOM, si
 
 	return State == JSON_FORMAT_COMPLETE;
 }
+
+
+bool JsonStreamFile(tJsonEdit *Edit, size_t EditCount, FILE *InputStream, tJsonUtfType UtfType, bool RequireBOM, size_t IndentSize, tJsonCommentType CommentType, FILE *OutputStream, size_t BufferSize, size_t *EditError)
+{
+	tJsonUtfType ReadUtfType;
+	tJsonStream Stream;
+	uint8_t ReadBuffer[JSON_BUFFER_SIZE(BufferSize)];
+	uint8_t WriteBuffer[JSON_BUFFER_SIZE(BufferSize)];
+	size_t ReadLength;
+	size_t ReadOffset;
+	size_t WriteOffset;
+	int ParseState = JSON_STREAM_INCOMPLETE;
+	int State = JSON_STREAM_WAITING;
+
+	JsonStreamSetUp(&Stream, IndentSize, CommentType, Edit, EditCount);
+
+#ifdef __WIN32__
+	setmode(fileno(InputStream), O_BINARY);
+	setmode(fileno(OutputStream), O_BINARY);
+#endif
+
+	WriteOffset = RequireBOM ? JsonUtfEncode(UtfType, WriteBuffer, JSON_BUFFER_SIZE(BufferSize), 0, JSON_CHARACTER_BOM) : 0;
+
+	ReadLength = fread(ReadBuffer, 1, JSON_BUFFER_SIZE(BufferSize), InputStream);
+
+	ReadOffset = JsonUtfGetType(ReadBuffer, ReadLength, &ReadUtfType);
+
+	while (((State == JSON_STREAM_WAITING) || (Stream.EditError < Stream.EditCount)) && (ParseState == JSON_STREAM_INCOMPLETE))
+	{
+		if (ReadLength > 0)
+		{
+			ParseState = JsonStreamParse(&Stream, ReadUtfType, ReadBuffer, ReadLength, &ReadOffset);
+			if ((ParseState == JSON_STREAM_INCOMPLETE) && (ReadOffset != 0))
+			{
+				memmove(ReadBuffer, &ReadBuffer[ReadOffset], ReadLength - ReadOffset);
+				ReadOffset = ReadLength - ReadOffset;
+				ReadLength = ReadOffset + fread(&ReadBuffer[ReadOffset], 1, JSON_BUFFER_SIZE(BufferSize) - ReadOffset, InputStream);
+				ReadOffset = 0;
+			}
+			else if (ParseState == JSON_STREAM_INCOMPLETE)
+			{
+				ParseState = JSON_STREAM_ERROR;
+			}
+		}
+		else
+		{
+			ReadLength = JsonUtfEncode(ReadUtfType, ReadBuffer, JSON_BUFFER_SIZE(BufferSize), 0, '\0');
+			ParseState = JsonStreamParse(&Stream, ReadUtfType, ReadBuffer, ReadLength, NULL);
+			if (ParseState == JSON_STREAM_INCOMPLETE)
+			{
+				ParseState = JSON_STREAM_ERROR;
+			}
+		}
+
+		do
+		{
+			State = JsonStreamFormat(&Stream, UtfType, WriteBuffer, JSON_BUFFER_SIZE(BufferSize), &WriteOffset);
+			if ((State != JSON_STREAM_ERROR) && (WriteOffset > 0) && (fwrite(WriteBuffer, 1, WriteOffset, OutputStream) != WriteOffset))
+			{
+				State = JSON_STREAM_ERROR;
+			}
+			WriteOffset = 0;
+		}
+		while (State == JSON_STREAM_INCOMPLETE);
+	}
+
+	if (EditError != NULL)
+	{
+		*EditError = (Stream.ParseState == JSON_PARSE_COMPLETE) ? Stream.EditError : EditCount + 1;
+	}
+
+	JsonStreamCleanUp(&Stream);
+
+	return (ParseState == JSON_STREAM_COMPLETE) && (State == JSON_STREAM_COMPLETE);
+}
@@ -2,8 +2,11 @@
 #define JSON_H
 
 #include <stdio.h>
+#include "json_event.h"
 #include "json_parse.h"
 #include "json_format.h"
+#include "json_record.h"
+#include "json_stream.h"
 
 
 /**
@@ -28,6 +31,19 @@ bool JsonReadStringAscii(tJsonElement *Root, bool StripComments, const char *Str
 bool JsonReadStringUtf8(tJsonElement *Root, bool StripComments, const uint8_t *String);
 
 
+/**
+ * @brief Reads JSON content from a string without copying the element names (where possible)
+ * @param Root          The root JSON element
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param String        The null terminated UTF-8 encoded string containing the JSON content
+ * @return A true value is returned if the JSON content was successfully read from the string.
+ * @return A false value is returned if the JSON content could not be read from the string.
+ * @note Element names without any escaped characters are views of the string (see \a `JsonParseSetUpView()`).
+ * @note The string must remain unchanged (and must not be freed) until the elements are cleared from \a `Root`.
+ */
+bool JsonReadStringUtf8View(tJsonElement *Root, bool StripComments, const uint8_t *String);
+
+
 /**
  * @brief Reads JSON content from a file
  * @param Root          The root JSON element
@@ -37,10 +53,104 @@ bool JsonReadStringUtf8(tJsonElement *Root, bool StripComments, const uint8_t *S
  * @return A true value is returned if the JSON content was successfully read from the file.
  * @return A false value is returned if the JSON content could not be read from the file.
  * @note The buffer is allocated on the stack and should not be too large.
+ * @note If the file is a regular file (and memory mapped files are supported) then the rest of the file is mapped into memory and parsed in one pass - the buffer is not used.
+ * @note Any other type of file (such as a pipe or a terminal) is read through the buffer.
  */
 bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t BufferSize);
 
 
+/**
+ * @brief Reads the parts of the JSON content from a file that match a set of paths
+ * @param Root          The root JSON element
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Path          The paths of the elements to read (see \a `JsonElementFind()`)
+ * @param PathCount     The number of paths
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file.
+ * @return A false value is returned if the JSON content could not be read from the file.
+ * @note Only the matching elements (with all of their children) and their ancestors are allocated (see \a `JsonParseSetUpFilter()`) - \a `JsonElementFind()` returns the same elements for the paths as it would for the whole content.
+ */
+bool JsonReadFileFilter(tJsonElement *Root, bool StripComments, const tJsonPath *Path, size_t PathCount, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Reads the element that matches a path from a file (stopping as soon as it has been read)
+ * @param Root          The root JSON element (its only child is set to the value of the element that was found)
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Path          The path of the element to read (see \a `JsonElementFind()`)
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file (up to the end of the element) - the root element does not have any children if the element was not found.
+ * @return A false value is returned if the JSON content could not be read from the file.
+ * @note The content is parsed through a filter (see \a `JsonReadFileFilter()`) and the file is not read any further once the element (and all of its children) has been parsed.
+ * @note If the path uses an array selector or a negative array position then the array child (or the whole array) must be parsed before the element is known to match.
+ * @note If an object has duplicate keys then only the first one is searched (the same as \a `JsonElementFind()` on the whole content) - a later key with the same name is never returned.
+ * @note The file is always read through the buffer (it is not memory mapped), which is allocated on the stack and should not be too large.
+ */
+bool JsonReadFind(tJsonElement *Root, bool StripComments, tJsonPath Path, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Reads JSON content from a file, calling a function as each element is parsed (without keeping the parsed elements)
+ * @param Callback      The function to call for each element (see \a `JsonParseSetUpCallback()`)
+ * @param Context       The context to pass to the callback function
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file.
+ * @return A false value is returned if the JSON content could not be read from the file (or the callback function stopped the parsing).
+ * @note The file is read as per \a `JsonReadFile()` - the memory used by the parser only depends on the nesting depth and the longest key, string, literal or comment.
+ * @note The element that is passed to the callback function (and its name) is only valid until the function returns.
+ */
+bool JsonReadFileCallback(tJsonParseCallback Callback, void *Context, bool StripComments, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Reads JSON content from a file as a sequence of parsing events (without building any elements)
+ * @param Callback      The function to call for each event
+ * @param Context       The context to pass to the callback function
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file.
+ * @return A false value is returned if the JSON content could not be read from the file (or the callback function stopped the parsing).
+ * @note The buffer is allocated on the stack and should not be too large - the memory used by the parser only depends on the nesting depth and the longest key, string, literal or comment.
+ */
+bool JsonReadFileEvents(tJsonEventCallback Callback, void *Context, bool StripComments, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Reads a sequence of JSON documents from a file (such as newline delimited JSON) and parses them on a pool of worker threads
+ * @param Callback      The function to call for each document (see \a `tJsonRecordCallback`)
+ * @param Context       The context to pass to the callback function
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Unordered     Indicates whether the documents can be passed to the callback function out of order (see \a `JsonRecordSetUp()`)
+ * @param ThreadCount   The number of worker threads to use (zero parses the documents on the calling thread)
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if all of the documents were read from the file (a document that could not be parsed is passed to the callback function as a \a `NULL` root element).
+ * @return A false value is returned if the documents could not be read from the file (or the callback function stopped the reading).
+ * @note The documents can be separated by newlines, any other whitespace or nothing at all (when they are objects, arrays or strings).
+ * @note Only UTF-8 encoded content is supported - UTF-16 encoded content is not read.
+ * @note The buffer is allocated on the stack and should not be too large.
+ */
+bool JsonReadFileRecords(tJsonRecordCallback Callback, void *Context, bool StripComments, bool Unordered, size_t ThreadCount, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Reads JSON content from a file path
+ * @param Root          The root JSON element
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Path          The path of the file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file.
+ * @return A false value is returned if the file could not be opened or the JSON content could not be read from the file.
+ * @note The file is read using \a `JsonReadFile()` (so a regular file will be memory mapped).
+ */
+bool JsonReadPath(tJsonElement *Root, bool StripComments, const char *Path, size_t BufferSize);
+
+
 /**
  * @brief Writes JSON content to a file
  * @param Root        The root JSON element
@@ -58,4 +168,26 @@ bool JsonReadFile(tJsonElement *Root, bool StripComments, FILE *Stream, size_t B
 bool JsonWriteFile(tJsonElement *Root, tJsonUtfType UtfType, bool RequireBOM, size_t IndentSize, tJsonCommentType CommentType, FILE *Stream, size_t BufferSize);
 
 
+/**
+ * @brief Streams JSON content from one file to another (applying any edits on the way)
+ * @param Edit         The edits to apply (in order)
+ * @param EditCount    The number of edits
+ * @param InputStream  The file to read the JSON content from
+ * @param UtfType      The type of encoding to use for the written content
+ * @param RequireBOM   Indicates if a byte order mark should be encoded at the start of the written content
+ * @param IndentSize   The number of spaces to use for each indentation
+ * @param CommentType  Indicates how to format any comments
+ * @param OutputStream The file to write the JSON content to
+ * @param BufferSize   The size of the buffers that are used when reading and writing the content
+ * @param EditError    Used to return the index of the first edit that could not be applied (or \a `EditCount` if all of the edits were applied, or \a `EditCount` + 1 if the content could not be read) - this may be \a `NULL`
+ * @return A true value is returned if the JSON content was successfully read, edited and written.
+ * @return A false value is returned if the JSON content could not be read or written (or an edit could not be applied - see \a `tJsonEdit.State`).
+ * @note This writes the same content as \a `JsonReadFile()`, \a `JsonElementFind()` (for each edit) and \a `JsonWriteFile()` - but only the elements that are targeted by an edit are kept in memory until they are written (see \a `tJsonStream`).
+ * @note The errors are also the same - if the content cannot be read then no edit error is returned, otherwise the first edit that cannot be applied (in order) is returned.
+ * @note The content is written while it is being read - if an error occurs then some of the content may have been written already.
+ * @note The buffers are allocated on the stack and should not be too large.
+ */
+bool JsonStreamFile(tJsonEdit *Edit, size_t EditCount, FILE *InputStream, tJsonUtfType UtfType, bool RequireBOM, size_t IndentSize, tJsonCommentType CommentType, FILE *OutputStream, size_t BufferSize, size_t *EditError);
+
+
 #endif
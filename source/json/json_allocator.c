@@ -0,0 +1,57 @@
+#include <string.h>
+#include "json_allocator.h"
+
+
+void *JsonAllocatorAllocate(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, size_t Size)
+{
+	if (Allocator == NULL)
+	{
+		return JSON_STATS_MALLOC(Subsystem, Size);
+	}
+
+	return Allocator->Allocate(Allocator->Context, Size);
+}
+
+
+void *JsonAllocatorReallocate(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, void *Memory, size_t Size, size_t NewSize)
+{
+	void *NewMemory;
+
+	if (Allocator == NULL)
+	{
+		return JSON_STATS_REALLOC(Subsystem, Memory, NewSize);
+	}
+
+	if (Allocator->Reallocate != NULL)
+	{
+		return Allocator->Reallocate(Allocator->Context, Memory, Size, NewSize);
+	}
+
+	NewMemory = Allocator->Allocate(Allocator->Context, NewSize);
+	if ((NewMemory != NULL) && (Memory != NULL))
+	{
+		memcpy(NewMemory, Memory, (Size < NewSize) ? Size : NewSize);
+		JsonAllocatorFree(Allocator, Subsystem, Memory, Size);
+	}
+
+	return NewMemory;
+}
+
+
+void JsonAllocatorFree(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, void *Memory, size_t Size)
+{
+	if (Allocator == NULL)
+	{
+		JSON_STATS_FREE(Subsystem, Memory);
+	}
+	else if ((Allocator->Free != NULL) && (Memory != NULL))
+	{
+		Allocator->Free(Allocator->Context, Memory, Size);
+	}
+}
+
+
+bool JsonAllocatorCanFree(const tJsonAllocator *Allocator)
+{
+	return (Allocator == NULL) || (Allocator->Free != NULL);
+}
@@ -0,0 +1,67 @@
+#ifndef JSON_ALLOCATOR_H
+#define JSON_ALLOCATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "json_stats.h"
+
+
+/**
+ * @brief Type used for a memory allocator (a table of allocation functions and the context that is passed to them)
+ * @note A \a `NULL` allocator pointer is used for the default allocator (the C library heap functions).
+ */
+typedef struct tJsonAllocator
+{
+	void *(* Allocate)(void *Context, size_t Size);                                 /**< Allocates memory (returns \a `NULL` on failure) */
+	void *(* Reallocate)(void *Context, void *Memory, size_t Size, size_t NewSize); /**< Reallocates memory from a current size to a new size (or \a `NULL` to allocate, copy and free instead) */
+	void  (* Free)(void *Context, void *Memory, size_t Size);                       /**< Frees memory of a given size (or \a `NULL` if memory is only ever freed in bulk by the owner of the allocator) */
+	void   *Context;                                                                /**< The context passed to the allocation functions */
+} tJsonAllocator;
+
+
+/**
+ * @brief Allocates memory using an allocator
+ * @param Allocator The allocator (or \a `NULL` for the default allocator)
+ * @param Subsystem The subsystem that the memory is allocated for (used for the statistics of the default allocator)
+ * @param Size      The size (in bytes) of the memory to allocate
+ * @return A pointer to the allocated memory.
+ * @return A \a `NULL` value is returned if the memory could not be allocated.
+ */
+void *JsonAllocatorAllocate(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, size_t Size);
+
+
+/**
+ * @brief Reallocates memory using an allocator
+ * @param Allocator The allocator (or \a `NULL` for the default allocator)
+ * @param Subsystem The subsystem that the memory is allocated for (used for the statistics of the default allocator)
+ * @param Memory    The memory that was previously allocated from the allocator (or \a `NULL`)
+ * @param Size      The current size (in bytes) of the memory
+ * @param NewSize   The new size (in bytes) of the memory
+ * @return A pointer to the reallocated memory.
+ * @return A \a `NULL` value is returned if the memory could not be reallocated (the original memory is left unchanged).
+ */
+void *JsonAllocatorReallocate(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, void *Memory, size_t Size, size_t NewSize);
+
+
+/**
+ * @brief Frees memory using an allocator
+ * @param Allocator The allocator (or \a `NULL` for the default allocator)
+ * @param Subsystem The subsystem that the memory was allocated for (used for the statistics of the default allocator)
+ * @param Memory    The memory that was previously allocated from the allocator (or \a `NULL`)
+ * @param Size      The size (in bytes) of the memory
+ * @return None
+ * @note Nothing is done if the allocator only frees memory in bulk.
+ */
+void JsonAllocatorFree(const tJsonAllocator *Allocator, tJsonStatsSubsystem Subsystem, void *Memory, size_t Size);
+
+
+/**
+ * @brief Checks if an allocator frees individual memory allocations
+ * @param Allocator The allocator (or \a `NULL` for the default allocator)
+ * @return A true value is returned if memory allocated from the allocator should be freed with \a `JsonAllocatorFree()`.
+ * @return A false value is returned if memory is only freed in bulk (by the owner of the allocator).
+ */
+bool JsonAllocatorCanFree(const tJsonAllocator *Allocator);
+
+
+#endif
@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <string.h>
+#include "json_arena.h"
+#include "json_stats.h"
+
+
+#define JSON_ARENA_ALIGN(n) ((((n) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
+
+
+static tJsonArenaChunk *JsonArenaAllocateChunk(tJsonArena *Arena, size_t Size)
+{
+	tJsonArenaChunk *Chunk;
+
+	if (Size < Arena->ChunkSize)
+	{
+		Size = Arena->ChunkSize;
+	}
+
+	if (Size > SIZE_MAX - sizeof(tJsonArenaChunk))
+	{
+		return NULL;
+	}
+
+	Chunk = (tJsonArenaChunk *)JSON_STATS_MALLOC(json_StatsArena, sizeof(tJsonArenaChunk) + Size);
+	if (Chunk != NULL)
+	{
+		Chunk->Next = Arena->Chunk;
+		Chunk->Size = Size;
+		Chunk->Used = 0;
+		Chunk->LastUsed = 0;
+		Arena->Chunk = Chunk;
+	}
+
+	return Chunk;
+}
+
+
+void JsonArenaSetUp(tJsonArena *Arena, size_t ChunkSize)
+{
+	Arena->Chunk = NULL;
+	Arena->ChunkSize = JSON_ARENA_ALIGN((ChunkSize == 0) ? JSON_ARENA_CHUNK_SIZE : ChunkSize);
+}
+
+
+void JsonArenaCleanUp(tJsonArena *Arena)
+{
+	JsonArenaClear(Arena);
+}
+
+
+void JsonArenaClear(tJsonArena *Arena)
+{
+	tJsonArenaChunk *Chunk;
+
+	while (Arena->Chunk != NULL)
+	{
+		Chunk = Arena->Chunk;
+		Arena->Chunk = Chunk->Next;
+		JSON_STATS_FREE(json_StatsArena, Chunk);
+	}
+}
+
+
+void *JsonArenaAllocate(tJsonArena *Arena, size_t Size)
+{
+	tJsonArenaChunk *Chunk;
+	uint8_t *Content;
+
+	if ((Size == 0) || (Size > SIZE_MAX - _Alignof(max_align_t)))
+	{
+		return NULL;
+	}
+
+	Size = JSON_ARENA_ALIGN(Size);
+
+	Chunk = Arena->Chunk;
+	if ((Chunk == NULL) || (Chunk->Size - Chunk->Used < Size))
+	{
+		Chunk = JsonArenaAllocateChunk(Arena, Size);
+		if (Chunk == NULL)
+		{
+			return NULL;
+		}
+	}
+
+	Content = (uint8_t *)Chunk->Content;
+	Chunk->LastUsed = Chunk->Used;
+	Chunk->Used = Chunk->Used + Size;
+
+	return &Content[Chunk->LastUsed];
+}
+
+
+void *JsonArenaReallocate(tJsonArena *Arena, void *Content, size_t Size, size_t NewSize)
+{
+	tJsonArenaChunk *Chunk;
+	void *NewContent;
+
+	if (Content == NULL)
+	{
+		return JsonArenaAllocate(Arena, NewSize);
+	}
+
+	if ((NewSize == 0) || (NewSize > SIZE_MAX - _Alignof(max_align_t)))
+	{
+		return NULL;
+	}
+
+	Chunk = Arena->Chunk;
+	if ((Chunk != NULL) && (Content == (void *)&((uint8_t *)Chunk->Content)[Chunk->LastUsed]) && (JSON_ARENA_ALIGN(NewSize) <= Chunk->Size - Chunk->LastUsed))
+	{
+		Chunk->Used = Chunk->LastUsed + JSON_ARENA_ALIGN(NewSize);
+		return Content;
+	}
+
+	NewContent = JsonArenaAllocate(Arena, NewSize);
+	if (NewContent != NULL)
+	{
+		memcpy(NewContent, Content, (Size < NewSize) ? Size : NewSize);
+	}
+
+	return NewContent;
+}
+
+
+static void *JsonArenaAllocatorAllocate(void *Context, size_t Size)
+{
+	return JsonArenaAllocate((tJsonArena *)Context, Size);
+}
+
+
+static void *JsonArenaAllocatorReallocate(void *Context, void *Memory, size_t Size, size_t NewSize)
+{
+	return JsonArenaReallocate((tJsonArena *)Context, Memory, Size, NewSize);
+}
+
+
+void JsonArenaGetAllocator(tJsonArena *Arena, tJsonAllocator *Allocator)
+{
+	Allocator->Allocate = JsonArenaAllocatorAllocate;
+	Allocator->Reallocate = JsonArenaAllocatorReallocate;
+	Allocator->Free = NULL;
+	Allocator->Context = Arena;
+}
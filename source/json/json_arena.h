@@ -0,0 +1,100 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_allocator.h"
+
+
+/**
+ * @brief The default size (in bytes) of a chunk of arena memory
+ */
+#define JSON_ARENA_CHUNK_SIZE 65536
+
+
+/**
+ * @brief Type used for a chunk of arena memory
+ */
+typedef struct tJsonArenaChunk
+{
+	struct tJsonArenaChunk *Next;      /**< The next (previously allocated) chunk */
+	size_t                  Size;      /**< The size of the chunk content */
+	size_t                  Used;      /**< The number of bytes in the chunk content that have been allocated */
+	size_t                  LastUsed;  /**< The offset to the last allocation made from the chunk content */
+	max_align_t             Content[]; /**< The chunk content */
+} tJsonArenaChunk;
+
+
+/**
+ * @brief Type used for an arena memory allocator
+ */
+typedef struct tJsonArena
+{
+	tJsonArenaChunk *Chunk;     /**< The current chunk that memory is allocated from */
+	size_t           ChunkSize; /**< The size of the content for each chunk */
+} tJsonArena;
+
+
+/**
+ * @brief Sets up an arena
+ * @param Arena     The arena to set up
+ * @param ChunkSize The size (in bytes) of each chunk of memory that is allocated for the arena
+ * @return None
+ * @note If \a `ChunkSize` is zero then \a `JSON_ARENA_CHUNK_SIZE` will be used
+ * @note Use \a `JsonArenaCleanUp()` to clean up the arena when it is no longer required
+ */
+void JsonArenaSetUp(tJsonArena *Arena, size_t ChunkSize);
+
+
+/**
+ * @brief Cleans up an arena
+ * @param Arena The arena to clean up
+ * @return None
+ * @note All of the memory that was allocated from the arena will be freed
+ */
+void JsonArenaCleanUp(tJsonArena *Arena);
+
+
+/**
+ * @brief Clears an arena (freeing all of the memory that was allocated from it)
+ * @param Arena The arena to clear
+ * @return None
+ */
+void JsonArenaClear(tJsonArena *Arena);
+
+
+/**
+ * @brief Allocates memory from an arena
+ * @param Arena The arena
+ * @param Size  The size (in bytes) of the memory to allocate
+ * @return A pointer to the allocated memory.
+ * @return A \a `NULL` value is returned if the memory could not be allocated.
+ * @note The memory is suitably aligned for any type. It cannot be freed individually - it is only freed when the arena is cleared.
+ */
+void *JsonArenaAllocate(tJsonArena *Arena, size_t Size);
+
+
+/**
+ * @brief Reallocates memory from an arena
+ * @param Arena   The arena
+ * @param Content The memory that was previously allocated from the arena (or \a `NULL`)
+ * @param Size    The current size (in bytes) of the memory
+ * @param NewSize The new size (in bytes) of the memory
+ * @return A pointer to the reallocated memory.
+ * @return A \a `NULL` value is returned if the memory could not be reallocated (the original memory is left unchanged).
+ * @note The memory is extended in place if it was the last allocation that was made from the arena (and there is room for it in the current chunk).
+ */
+void *JsonArenaReallocate(tJsonArena *Arena, void *Content, size_t Size, size_t NewSize);
+
+
+/**
+ * @brief Gets an allocator that allocates memory from an arena
+ * @param Arena     The arena
+ * @param Allocator Updated with the allocator functions (and the arena as the allocator context)
+ * @return None
+ * @note The allocator does not free memory individually - the memory is freed when the arena is cleared.
+ */
+void JsonArenaGetAllocator(tJsonArena *Arena, tJsonAllocator *Allocator);
+
+
+#endif
@@ -1,14 +1,92 @@
 #include <stdlib.h>
+#include <string.h>
+#include "json_arena.h"
 #include "json_element.h"
+#include "json_recycle.h"
+#include "json_stats.h"
 
 
-static void JsonElementSetUpType(tJsonElement *Element, tJsonType Type, tJsonElement *Parent)
+/**
+ * @brief Type used for the arena that is owned by a root element (see \a `JsonElementSetUpArena()`)
+ */
+typedef struct
+{
+	tJsonAllocator Allocator; /**< The allocator that allocates memory from the arena */
+	tJsonArena     Arena;     /**< The arena */
+} tJsonElementArena;
+
+
+/**
+ * @brief Type used for the recycling allocator that is owned by a root element (see \a `JsonElementSetUpRecycle()`)
+ */
+typedef struct
+{
+	tJsonAllocator Allocator; /**< The allocator that allocates memory from the recycling allocator */
+	tJsonRecycle   Recycle;   /**< The recycling allocator */
+} tJsonElementRecycle;
+
+
+static void *JsonElementArenaAllocate(void *Context, size_t Size)
+{
+	return JsonArenaAllocate((tJsonArena *)Context, Size);
+}
+
+
+static void *JsonElementArenaReallocate(void *Context, void *Memory, size_t Size, size_t NewSize)
+{
+	return JsonArenaReallocate((tJsonArena *)Context, Memory, Size, NewSize);
+}
+
+
+static void *JsonElementRecycleAllocate(void *Context, size_t Size)
+{
+	return JsonRecycleAllocate((tJsonRecycle *)Context, Size);
+}
+
+
+static void *JsonElementRecycleReallocate(void *Context, void *Memory, size_t Size, size_t NewSize)
+{
+	return JsonRecycleReallocate((tJsonRecycle *)Context, Memory, Size, NewSize);
+}
+
+
+static void JsonElementRecycleFree(void *Context, void *Memory, size_t Size)
+{
+	JsonRecycleFree((tJsonRecycle *)Context, Memory, Size);
+}
+
+
+static tJsonRecycle *JsonElementGetRecycle(const tJsonElement *Element)
+{
+	if ((Element->Type == json_TypeRoot) && (Element->Allocator != NULL) && (Element->Allocator->Allocate == JsonElementRecycleAllocate))
+	{
+		return (tJsonRecycle *)Element->Allocator->Context;
+	}
+
+	return NULL;
+}
+
+
+static tJsonArena *JsonElementGetArena(const tJsonElement *Element)
+{
+	if ((Element->Type == json_TypeRoot) && (Element->Allocator != NULL) && (Element->Allocator->Allocate == JsonElementArenaAllocate))
+	{
+		return (tJsonArena *)Element->Allocator->Context;
+	}
+
+	return NULL;
+}
+
+
+static void JsonElementSetUpType(tJsonElement *Element, tJsonType Type, tJsonElement *Parent, const tJsonAllocator *Allocator)
 {
 	Element->Type = Type;
 	Element->Parent = Parent;
 	Element->Next = NULL;
 	Element->Child = NULL;
-	JsonStringSetUp(&Element->Name);
+	Element->Allocator = Allocator;
+	Element->Index = NULL;
+	JsonStringSetUpAllocator(&Element->Name, Allocator);
 }
 
 
@@ -41,6 +119,275 @@ static bool JsonElementCheckChildType(tJsonType ParentType, tJsonType ChildType)
 }
 
 
+static void JsonElementFreeIndex(tJsonElement *Element)
+{
+	if (Element->Index != NULL)
+	{
+		JsonAllocatorFree(Element->Allocator, json_StatsElement, Element->Index, sizeof(tJsonElementIndex) + Element->Index->Size * sizeof(tJsonElementIndexEntry));
+		Element->Index = NULL;
+	}
+}
+
+
+void JsonElementClearIndex(tJsonElement *Element)
+{
+	if ((Element != NULL) && (Element->Index != NULL))
+	{
+		Element->Index->Valid = false;
+	}
+}
+
+
+static bool JsonElementInsertIndex(tJsonElementIndex *Index, tJsonElement *Element)
+{
+	size_t n;
+
+	if ((Index->Count + 1) * 2 > Index->Size)
+	{
+		Index->Valid = false;
+		return false;
+	}
+
+	for (n = JsonStringGetHash(&Element->Name) & (Index->Size - 1); Index->Entry[n].Element != NULL; n = (n + 1) & (Index->Size - 1))
+		;
+
+	Index->Entry[n].Hash = JsonStringGetHash(&Element->Name);
+	Index->Entry[n].Element = Element;
+	Index->Count++;
+
+	return true;
+}
+
+
+static bool JsonElementReserveIndex(tJsonElement *Element, size_t Count)
+{
+	size_t Size;
+
+	if ((Count < JSON_ELEMENT_INDEX_THRESHOLD) || (Count > SIZE_MAX / (4 * sizeof(tJsonElementIndexEntry))))
+	{
+		return false;
+	}
+
+	for (Size = JSON_ELEMENT_INDEX_THRESHOLD * 2; Size < Count * 2; Size = Size * 2)
+		;
+
+	if ((Element->Index == NULL) || (Element->Index->Size < Size))
+	{
+		JsonElementFreeIndex(Element);
+		Element->Index = (tJsonElementIndex *)JsonAllocatorAllocate(Element->Allocator, json_StatsElement, sizeof(tJsonElementIndex) + Size * sizeof(tJsonElementIndexEntry));
+
+		if (Element->Index == NULL)
+		{
+			return false;
+		}
+		Element->Index->Size = Size;
+	}
+
+	memset(Element->Index->Entry, 0, Element->Index->Size * sizeof(tJsonElementIndexEntry));
+	Element->Index->Count = 0;
+	Element->Index->Last = NULL;
+	Element->Index->Valid = true;
+
+	return true;
+}
+
+
+static bool JsonElementBuildIndex(tJsonElement *Element)
+{
+	tJsonElement *Child;
+	tJsonElement *Last = NULL;
+	size_t Count = 0;
+
+	if (Element->Type != json_TypeObject)
+	{
+		return false;
+	}
+	else if ((Element->Index != NULL) && Element->Index->Valid)
+	{
+		return true;
+	}
+
+	for (Child = Element->Child; Child != NULL; Child = Child->Next)
+	{
+		Count = Count + ((Child->Type == json_TypeKey) ? 1 : 0);
+		Last = Child;
+	}
+
+	if (!JsonElementReserveIndex(Element, Count))
+	{
+		return false;
+	}
+
+	Element->Index->Last = Last;
+
+	for (Child = Element->Child; Child != NULL; Child = Child->Next)
+	{
+		if (Child->Type == json_TypeKey)
+		{
+			JsonElementInsertIndex(Element->Index, Child);
+		}
+	}
+
+	return true;
+}
+
+
+static bool JsonElementBuildArrayIndex(tJsonElement *Element)
+{
+	tJsonElement *Child;
+	tJsonElement *Last = NULL;
+	size_t Count = 0;
+
+	if (Element->Type != json_TypeArray)
+	{
+		return false;
+	}
+	else if ((Element->Index != NULL) && Element->Index->Valid)
+	{
+		return true;
+	}
+
+	for (Child = Element->Child; Child != NULL; Child = Child->Next)
+	{
+		Count = Count + ((Child->Type != json_TypeComment) ? 1 : 0);
+		Last = Child;
+	}
+
+	if (!JsonElementReserveIndex(Element, Count))
+	{
+		return false;
+	}
+
+	Element->Index->Last = Last;
+
+	for (Child = Element->Child; Child != NULL; Child = Child->Next)
+	{
+		if (Child->Type != json_TypeComment)
+		{
+			Element->Index->Entry[Element->Index->Count].Element = Child;
+			Element->Index->Count++;
+		}
+	}
+
+	return true;
+}
+
+
+static void JsonElementAppendIndex(tJsonElement *Element, tJsonElement *Child)
+{
+	tJsonElementIndex *Index = Element->Index;
+
+	if ((Index != NULL) && Index->Valid && (Child != NULL))
+	{
+		if ((Element->Type == json_TypeArray) && (Index->Last != NULL) && (Index->Last->Next == Child) && (Index->Count < Index->Size))
+		{
+			Index->Entry[Index->Count].Element = Child;
+			Index->Count++;
+			Index->Last = Child;
+		}
+		else
+		{
+			Index->Valid = false;
+		}
+	}
+}
+
+
+static tJsonElement **JsonElementFindPosition(tJsonElement *Element, ptrdiff_t Position, bool Create)
+{
+	tJsonElement **Child;
+	size_t Count = 0;
+
+	if (JsonElementBuildArrayIndex(Element))
+	{
+		Count = Element->Index->Count;
+		if (Position < 0)
+		{
+			Position = ((size_t)-(Position + 1) < Count) ? (ptrdiff_t)(Count - (size_t)-(Position + 1) - 1) : -1;
+		}
+
+		if ((Position >= 0) && ((size_t)Position < Count))
+		{
+			return &Element->Index->Entry[Position].Element;
+		}
+
+		return (Create && ((size_t)Position == Count)) ? &Element->Index->Last->Next : NULL;
+	}
+
+	if (Position < 0)
+	{
+		for (Child = &Element->Child; *Child != NULL; Child = &(*Child)->Next)
+		{
+			Count = Count + (((*Child)->Type != json_TypeComment) ? 1 : 0);
+		}
+
+		if ((size_t)-(Position + 1) >= Count)
+		{
+			return NULL;
+		}
+		Position = (ptrdiff_t)(Count - (size_t)-(Position + 1) - 1);
+	}
+
+	for (Child = &Element->Child; *Child != NULL; Child = &(*Child)->Next)
+	{
+		if ((*Child)->Type != json_TypeComment)
+		{
+			if (Position == 0)
+			{
+				return Child;
+			}
+			Position--;
+		}
+	}
+
+	return (Create && (Position == 0)) ? Child : NULL;
+}
+
+
+static tJsonElement **JsonElementFindIndex(tJsonElementIndex *Index, tJsonPath Path)
+{
+	uint32_t Hash;
+	size_t n;
+
+	if (!JsonPathGetHash(Path, &Hash))
+	{
+		return NULL;
+	}
+
+	for (n = Hash & (Index->Size - 1); Index->Entry[n].Element != NULL; n = (n + 1) & (Index->Size - 1))
+	{
+		if ((Index->Entry[n].Hash == Hash) && JsonPathCompareString(Path, &Index->Entry[n].Element->Name))
+		{
+			return &Index->Entry[n].Element;
+		}
+	}
+
+	return NULL;
+}
+
+
+static bool JsonElementCompareName(const tJsonElement *Element, const uint8_t *Name, size_t Length)
+{
+	return (Element->Name.Length == Length) && ((Length == 0) || (memcmp(Element->Name.Content, Name, Length) == 0));
+}
+
+
+static tJsonElement **JsonElementFindIndexName(tJsonElementIndex *Index, uint32_t Hash, const uint8_t *Name, size_t Length)
+{
+	size_t n;
+
+	for (n = Hash & (Index->Size - 1); Index->Entry[n].Element != NULL; n = (n + 1) & (Index->Size - 1))
+	{
+		if ((Index->Entry[n].Hash == Hash) && JsonElementCompareName(Index->Entry[n].Element, Name, Length))
+		{
+			return &Index->Entry[n].Element;
+		}
+	}
+
+	return NULL;
+}
+
+
 static tJsonElement *JsonElementAllocate(tJsonType Type, tJsonElement *Parent)
 {
 	tJsonElement *Element;
@@ -50,10 +397,10 @@ static tJsonElement *JsonElementAllocate(tJsonType Type, tJsonElement *Parent)
 		return NULL;
 	}
 
-	Element = (tJsonElement *)malloc(sizeof(tJsonElement));
+	Element = (tJsonElement *)JsonAllocatorAllocate(Parent->Allocator, json_StatsElement, sizeof(tJsonElement));
 	if (Element != NULL)
 	{
-		JsonElementSetUpType(Element, Type, Parent);
+		JsonElementSetUpType(Element, Type, Parent, Parent->Allocator);
 	}
 
 	return Element;
@@ -64,8 +411,8 @@ static void JsonElementFree(tJsonElement **Element)
 {
 	if (*Element != NULL)
 	{
-		JsonElementCleanUp(*Element);
-		free(*Element);
+		JsonElementClear(*Element);
+		JsonAllocatorFree((*Element)->Allocator, json_StatsElement, *Element, sizeof(tJsonElement));
 		*Element = NULL;
 	}
 }
@@ -84,8 +431,9 @@ static void JsonElementClearNext(tJsonElement *Element)
 		Element->Next = Next->Next;
 		Next->Next = NULL;
 		JsonStringClear(&Next->Name);
+		JsonElementFreeIndex(Next);
 		JsonElementClearChild(Next);
-		free(Next);
+		JsonAllocatorFree(Next->Allocator, json_StatsElement, Next, sizeof(tJsonElement));
 	}
 }
 
@@ -100,8 +448,9 @@ static void JsonElementClearChild(tJsonElement *Element)
 		Element->Child = Child->Child;
 		Child->Child = NULL;
 		JsonStringClear(&Child->Name);
+		JsonElementFreeIndex(Child);
 		JsonElementClearNext(Child);
-		free(Child);
+		JsonAllocatorFree(Child->Allocator, json_StatsElement, Child, sizeof(tJsonElement));
 	}
 }
 
@@ -109,26 +458,108 @@ static void JsonElementClearChild(tJsonElement *Element)
 void JsonElementClear(tJsonElement *Element)
 {
 	JsonStringClear(&Element->Name);
-	JsonElementClearChild(Element);
-	JsonElementClearNext(Element);
+	JsonElementFreeIndex(Element);
+	JsonElementClearIndex(Element->Parent);
+	if (!JsonAllocatorCanFree(Element->Allocator))
+	{
+		Element->Child = NULL;
+		Element->Next = NULL;
+		if (JsonElementGetArena(Element) != NULL)
+		{
+			JsonArenaClear(JsonElementGetArena(Element));
+		}
+	}
+	else
+	{
+		JsonElementClearChild(Element);
+		JsonElementClearNext(Element);
+	}
 }
 
 
 void JsonElementSetUp(tJsonElement *Element)
 {
-	JsonElementSetUpType(Element, json_TypeRoot, NULL);
+	JsonElementSetUpType(Element, json_TypeRoot, NULL, NULL);
+}
+
+
+bool JsonElementSetUpArena(tJsonElement *Element, size_t ChunkSize)
+{
+	tJsonElementArena *Arena;
+
+	Arena = (tJsonElementArena *)JSON_STATS_MALLOC(json_StatsArena, sizeof(tJsonElementArena));
+	if (Arena != NULL)
+	{
+		JsonArenaSetUp(&Arena->Arena, ChunkSize);
+		Arena->Allocator.Allocate = JsonElementArenaAllocate;
+		Arena->Allocator.Reallocate = JsonElementArenaReallocate;
+		Arena->Allocator.Free = NULL;
+		Arena->Allocator.Context = &Arena->Arena;
+	}
+
+	JsonElementSetUpType(Element, json_TypeRoot, NULL, (Arena != NULL) ? &Arena->Allocator : NULL);
+
+	return Arena != NULL;
+}
+
+
+bool JsonElementSetUpRecycle(tJsonElement *Element)
+{
+	tJsonElementRecycle *Recycle;
+
+	Recycle = (tJsonElementRecycle *)JSON_STATS_MALLOC(json_StatsRecycle, sizeof(tJsonElementRecycle));
+	if (Recycle != NULL)
+	{
+		JsonRecycleSetUp(&Recycle->Recycle);
+		Recycle->Allocator.Allocate = JsonElementRecycleAllocate;
+		Recycle->Allocator.Reallocate = JsonElementRecycleReallocate;
+		Recycle->Allocator.Free = JsonElementRecycleFree;
+		Recycle->Allocator.Context = &Recycle->Recycle;
+	}
+
+	JsonElementSetUpType(Element, json_TypeRoot, NULL, (Recycle != NULL) ? &Recycle->Allocator : NULL);
+
+	return Recycle != NULL;
+}
+
+
+void JsonElementSetUpAllocator(tJsonElement *Element, const tJsonAllocator *Allocator)
+{
+	JsonElementSetUpType(Element, json_TypeRoot, NULL, Allocator);
 }
 
 
 void JsonElementCleanUp(tJsonElement *Element)
 {
+	tJsonArena *Arena;
+	tJsonRecycle *Recycle;
+
 	JsonElementClear(Element);
+
+	Arena = JsonElementGetArena(Element);
+	if (Arena != NULL)
+	{
+		JsonArenaCleanUp(Arena);
+		JSON_STATS_FREE(json_StatsArena, (void *)Element->Allocator);
+		Element->Allocator = NULL;
+		JsonStringSetUp(&Element->Name);
+	}
+
+	Recycle = JsonElementGetRecycle(Element);
+	if (Recycle != NULL)
+	{
+		JsonRecycleCleanUp(Recycle);
+		JSON_STATS_FREE(json_StatsRecycle, (void *)Element->Allocator);
+		Element->Allocator = NULL;
+		JsonStringSetUp(&Element->Name);
+	}
 }
 
 
 bool JsonElementAllocateChild(tJsonElement *Element, tJsonType Type)
 {
 	JsonElementFree(&Element->Child);
+	JsonElementClearIndex(Element);
 
 	Element->Child = JsonElementAllocate(Type, Element);
 
@@ -139,6 +570,7 @@ bool JsonElementAllocateChild(tJsonElement *Element, tJsonType Type)
 bool JsonElementAllocateNext(tJsonElement *Element, tJsonType Type)
 {
 	JsonElementFree(&Element->Next);
+	JsonElementClearIndex(Element->Parent);
 
 	if (Element->Parent != NULL)
 	{
@@ -188,7 +620,55 @@ tJsonElement *JsonElementGetNext(tJsonElement *Element, bool IgnoreComments)
 }
 
 
-static tJsonElement **JsonElementFindSubPath(tJsonElement **Element, tJsonElement *Parent, tJsonPath Path, bool Create);
+/**
+ * @brief Type used for an array selector that is being searched by \a `JsonElementFindSubPath()`
+ */
+typedef struct
+{
+	tJsonElement **Array;     /**< The array element */
+	tJsonElement **Element;   /**< The array child that the selector path is being matched (or created) from */
+	tJsonPath      Component; /**< The selector path */
+	tJsonPath      Path;      /**< The rest of the path after the selector */
+	bool           Create;    /**< Indicates if the elements in the rest of the path should be created */
+	bool           Creating;  /**< Indicates if the selector path is being created (rather than matched) */
+	bool           Created;   /**< Indicates if the array element was created */
+} tJsonElementFindSelector;
+
+
+static tJsonElement **JsonElementFindKey(tJsonElement **Element, tJsonPath Path)
+{
+	tJsonString Name;
+	bool IsEscaped;
+	bool ok = true;
+
+	IsEscaped = (Path.Length != 0) && (memchr(Path.Value, '\\', Path.Length) != NULL);
+	if (IsEscaped)
+	{
+		JsonStringSetUp(&Name);
+		ok = JsonPathGetString(Path, &Name);
+	}
+
+	while (*Element != NULL)
+	{
+		if (ok && (IsEscaped ? JsonElementCompareName(*Element, Name.Content, Name.Length) : JsonPathCompareString(Path, &(*Element)->Name)))
+		{
+			break;
+		}
+
+		do
+		{
+			Element = &(*Element)->Next;
+		}
+		while ((*Element != NULL) && ((*Element)->Type == json_TypeComment));
+	}
+
+	if (IsEscaped)
+	{
+		JsonStringCleanUp(&Name);
+	}
+
+	return Element;
+}
 
 
 static tJsonElement *JsonElementCreatePath(tJsonType Type, tJsonElement *Parent, tJsonPath Path)
@@ -196,21 +676,11 @@ static tJsonElement *JsonElementCreatePath(tJsonType Type, tJsonElement *Parent,
 	tJsonElement *Element;
 
 	Element = JsonElementAllocate(Type, Parent);
-	if (Element != NULL)
+	if ((Element != NULL) && ((Type == json_TypeKey) || (Type == json_TypeValueString) || (Type == json_TypeValueLiteral)))
 	{
-		if ((Type == json_TypeKey) || (Type == json_TypeValueString) || (Type == json_TypeValueLiteral))
-		{
-			if (!JsonPathGetString(Path, &Element->Name))
-			{
-				JsonElementFree(&Element);
-			}
-		}
-		else if (Type == json_TypeArray)
+		if (!JsonPathGetString(Path, &Element->Name))
 		{
-			if (JsonElementFindSubPath(&Element->Child, Element, Path, true) == NULL)
-			{
-				JsonElementFree(&Element);
-			}
+			JsonElementFree(&Element);
 		}
 	}
 
@@ -218,11 +688,40 @@ static tJsonElement *JsonElementCreatePath(tJsonType Type, tJsonElement *Parent,
 }
 
 
+static tJsonElement **JsonElementFindSelector(tJsonElementFindSelector *Selector, tJsonPath *Path, bool *Create)
+{
+	while ((*Selector->Element != NULL) && ((*Selector->Element)->Type == json_TypeComment))
+	{
+		Selector->Element = &(*Selector->Element)->Next;
+	}
+
+	if ((*Selector->Element == NULL) && Selector->Create)
+	{
+		Selector->Creating = true;
+	}
+	else if (*Selector->Element == NULL)
+	{
+		return NULL;
+	}
+
+	*Path = Selector->Component;
+	*Create = Selector->Creating;
+
+	return Selector->Element;
+}
+
+
 static tJsonElement **JsonElementFindSubPath(tJsonElement **Element, tJsonElement *Parent, tJsonPath Path, bool Create)
 {
+	tJsonElementFindSelector Selector[JSON_ELEMENT_FIND_DEPTH];
+	tJsonElement **ElementReference;
 	tJsonPath Component;
 	tJsonType ComponentType;
+	ptrdiff_t Position;
+	size_t Depth = 0;
 	size_t Length;
+	bool IsPosition;
+	bool Created;
 
 	for (;;)
 	{
@@ -231,112 +730,328 @@ static tJsonElement **JsonElementFindSubPath(tJsonElement **Element, tJsonElemen
 			Element = &(*Element)->Next;
 		}
 
+		Created = false;
 		Length = JsonPathGetComponent(Path, &ComponentType, &Component);
+		IsPosition = (Length != 0) && (ComponentType == json_TypeArray) && JsonPathGetPosition(Component, &Position);
 		if (Length == 0)
 		{
-			return NULL;
+			Element = NULL;
+		}
+		else if ((ComponentType == json_TypeArray) && !IsPosition && (Depth == JSON_ELEMENT_FIND_DEPTH))
+		{
+			Element = NULL;
+		}
+		else if ((*Element == NULL) && Create)
+		{
+			*Element = JsonElementCreatePath(ComponentType, Parent, Component);
+			JsonElementAppendIndex(Parent, *Element);
+			Created = true;
 		}
 		else if (*Element == NULL)
 		{
-			if (Create)
+			Element = NULL;
+		}
+		else if (ComponentType != (*Element)->Type)
+		{
+			Element = NULL;
+		}
+		else if ((ComponentType == json_TypeKey) && JsonElementBuildIndex(Parent))
+		{
+			ElementReference = JsonElementFindIndex(Parent->Index, Component);
+			if (ElementReference != NULL)
+			{
+				Element = ElementReference;
+			}
+			else
 			{
-				*Element = JsonElementCreatePath(ComponentType, Parent, Component);
-				if ((ComponentType == json_TypeArray) && (*Element != NULL))
+				Element = (Parent->Index->Last != NULL) ? &Parent->Index->Last->Next : &Parent->Child;
+				if (Create)
 				{
-					Parent = *Element;
-					Element = &Parent->Child;
+					*Element = JsonElementCreatePath(json_TypeKey, Parent, Component);
+					if (*Element != NULL)
+					{
+						Parent->Index->Last = *Element;
+						JsonElementInsertIndex(Parent->Index, *Element);
+					}
 				}
 			}
 		}
-		else if (ComponentType != (*Element)->Type)
+		else if (ComponentType == json_TypeKey)
 		{
-			return NULL;
+			Element = JsonElementFindKey(Element, Component);
+
+			if ((*Element == NULL) && Create)
+			{
+				*Element = JsonElementCreatePath(json_TypeKey, Parent, Component);
+			}
 		}
-		else if (ComponentType == json_TypeArray)
+		else if ((ComponentType != json_TypeObject) && (ComponentType != json_TypeArray))
+		{
+			if (!JsonPathCompareString(Component, &(*Element)->Name))
+			{
+				Element = NULL;
+			}
+		}
+
+		if ((Element != NULL) && (*Element != NULL) && IsPosition)
 		{
 			Parent = *Element;
-			Element = &Parent->Child;
+			Element = JsonElementFindPosition(Parent, Position, Create);
+			Path = JsonPathRight(Path, Length);
+			if ((Element != NULL) && (*Element == NULL) && (Path.Length != 0))
+			{
+				continue;
+			}
+		}
+		else if ((Element != NULL) && (*Element != NULL) && (ComponentType == json_TypeArray))
+		{
+			Selector[Depth].Array = Element;
+			Selector[Depth].Element = &(*Element)->Child;
+			Selector[Depth].Component = Component;
+			Selector[Depth].Path = JsonPathRight(Path, Length);
+			Selector[Depth].Create = Create;
+			Selector[Depth].Creating = false;
+			Selector[Depth].Created = Created;
+			Parent = *Element;
+			Element = JsonElementFindSelector(&Selector[Depth], &Path, &Create);
+			if (Element != NULL)
+			{
+				Depth++;
+				continue;
+			}
+		}
+		else if ((Element != NULL) && (*Element != NULL))
+		{
+			Path = JsonPathRight(Path, Length);
+			if (Path.Length != 0)
+			{
+				Parent = *Element;
+				Element = &Parent->Child;
+				continue;
+			}
+		}
 
-			while (*Element != NULL)
+		if ((Element != NULL) && (*Element != NULL))
+		{
+			while ((Path.Length == 0) && (Depth > 0))
 			{
-				if (JsonElementFindSubPath(Element, Parent, Component, false) != NULL)
-				{
-					break;
-				}
+				Depth--;
+				Element = Selector[Depth].Element;
+				Parent = *Selector[Depth].Array;
+				Path = Selector[Depth].Path;
+				Create = Selector[Depth].Create;
+			}
 
-				do
-				{
-					Element = &(*Element)->Next;
-				}
-				while ((*Element != NULL) && ((*Element)->Type == json_TypeComment));
+			if (Path.Length == 0)
+			{
+				return Element;
 			}
+			continue;
+		}
 
-			if ((*Element == NULL) && Create)
+		Element = NULL;
+		while ((Element == NULL) && (Depth > 0))
+		{
+			if (Selector[Depth - 1].Creating)
+			{
+				JsonElementFree(Selector[Depth - 1].Created ? Selector[Depth - 1].Array : Selector[Depth - 1].Element);
+				Depth--;
+			}
+			else
 			{
-				if (JsonElementFindSubPath(Element, Parent, Component, true) == NULL)
+				Selector[Depth - 1].Element = &(*Selector[Depth - 1].Element)->Next;
+				Parent = *Selector[Depth - 1].Array;
+				Element = JsonElementFindSelector(&Selector[Depth - 1], &Path, &Create);
+				if (Element == NULL)
 				{
-					JsonElementFree(Element);
+					Depth--;
 				}
 			}
 		}
-		else if (ComponentType == json_TypeKey)
+
+		if (Element == NULL)
 		{
-			while (*Element != NULL)
+			return NULL;
+		}
+	}
+}
+
+
+tJsonElement *JsonElementFind(tJsonElement *Element, tJsonPath Path, bool Create)
+{
+	tJsonElement **ElementReference;
+	JSON_STATS_TIMER(Timer);
+
+	if ((Element != NULL) && (Element->Type == json_TypeRoot))
+	{
+		ElementReference = JsonElementFindSubPath(&Element->Child, Element, Path, Create);
+		Element = (ElementReference != NULL) ? *ElementReference : NULL;
+	}
+	else
+	{
+		Element = NULL;
+	}
+
+	JSON_STATS_TIME(json_StatsFind, Timer);
+
+	return Element;
+}
+
+
+/**
+ * @brief Type used for an array selector that is being searched by \a `JsonElementFindCompiledPath()`
+ */
+typedef struct
+{
+	tJsonElement  *Array;   /**< The array element */
+	tJsonElement **Element; /**< The array child that the selector path is being matched from */
+	size_t         Start;   /**< The index of the selector component */
+	size_t         End;     /**< The index of the end of the components that the selector component is in */
+} tJsonElementFindCompiledSelector;
+
+
+static tJsonElement **JsonElementFindCompiledPath(tJsonElement **Element, tJsonElement *Parent, const tJsonCompiledPath *Path)
+{
+	tJsonElementFindCompiledSelector Selector[JSON_ELEMENT_FIND_DEPTH];
+	const tJsonCompiledPathComponent *Component;
+	const uint8_t *Name;
+	size_t Depth = 0;
+	size_t End = Path->Count;
+	size_t Next;
+	size_t n = 0;
+
+	while (n < End)
+	{
+		while ((*Element != NULL) && ((*Element)->Type == json_TypeComment))
+		{
+			Element = &(*Element)->Next;
+		}
+
+		Component = &Path->Component[n];
+		Name = (Path->Names != NULL) ? &Path->Names[Component->Offset] : NULL;
+		Next = n + 1 + Component->Count;
+
+		if ((*Element == NULL) || (Component->Type != (*Element)->Type))
+		{
+			Element = NULL;
+		}
+		else if ((Component->Type == json_TypeArray) && Component->IsPosition)
+		{
+			Parent = *Element;
+			Element = JsonElementFindPosition(Parent, Component->Position, false);
+		}
+		else if ((Component->Type == json_TypeArray) && (Depth == JSON_ELEMENT_FIND_DEPTH))
+		{
+			return NULL;
+		}
+		else if (Component->Type == json_TypeArray)
+		{
+			Parent = *Element;
+			Element = &Parent->Child;
+			while ((*Element != NULL) && ((*Element)->Type == json_TypeComment))
 			{
-				if (JsonPathCompareString(Component, &(*Element)->Name))
-				{
-					break;
-				}
+				Element = &(*Element)->Next;
+			}
 
+			if ((*Element != NULL) && (Component->Count != 0))
+			{
+				Selector[Depth].Array = Parent;
+				Selector[Depth].Element = Element;
+				Selector[Depth].Start = n;
+				Selector[Depth].End = End;
+				Depth++;
+				End = Next;
+				n = n + 1;
+				continue;
+			}
+			Element = NULL;
+		}
+		else if ((Component->Type == json_TypeKey) && JsonElementBuildIndex(Parent))
+		{
+			Element = JsonElementFindIndexName(Parent->Index, Component->Hash, Name, Component->Length);
+		}
+		else if (Component->Type == json_TypeKey)
+		{
+			while ((*Element != NULL) && !JsonElementCompareName(*Element, Name, Component->Length))
+			{
 				do
 				{
 					Element = &(*Element)->Next;
 				}
 				while ((*Element != NULL) && ((*Element)->Type == json_TypeComment));
 			}
+		}
+		else if ((Component->Type != json_TypeObject) && !JsonElementCompareName(*Element, Name, Component->Length))
+		{
+			Element = NULL;
+		}
 
-			if ((*Element == NULL) && Create)
+		if ((Element != NULL) && (*Element != NULL))
+		{
+			while ((Next == End) && (Depth > 0))
 			{
-				*Element = JsonElementCreatePath(json_TypeKey, Parent, Component);
+				Depth--;
+				Element = Selector[Depth].Element;
+				Parent = Selector[Depth].Array;
+				n = Selector[Depth].Start;
+				End = Selector[Depth].End;
+				Next = n + 1 + Path->Component[n].Count;
 			}
-		}
-		else if (ComponentType != json_TypeObject)
-		{
-			if (!JsonPathCompareString(Component, &(*Element)->Name))
+
+			if (Next == End)
 			{
-				return NULL;
+				return Element;
 			}
-		}
 
-		if (*Element == NULL)
-		{
-			return NULL;
+			if (Path->Component[n].Type != json_TypeArray)
+			{
+				Parent = *Element;
+				Element = &Parent->Child;
+			}
+			n = Next;
+			continue;
 		}
 
-		Path = JsonPathRight(Path, Length);
-		if (Path.Length == 0)
+		while ((Element == NULL) || (*Element == NULL))
 		{
-			return Element;
-		}
+			if (Depth == 0)
+			{
+				return NULL;
+			}
 
-		if (ComponentType != json_TypeArray)
-		{
-			Parent = *Element;
-			Element = &Parent->Child;
+			Element = Selector[Depth - 1].Element;
+			do
+			{
+				Element = &(*Element)->Next;
+			}
+			while ((*Element != NULL) && ((*Element)->Type == json_TypeComment));
+
+			if (*Element == NULL)
+			{
+				Depth--;
+			}
+			else
+			{
+				Selector[Depth - 1].Element = Element;
+				Parent = Selector[Depth - 1].Array;
+				n = Selector[Depth - 1].Start + 1;
+				End = n + Path->Component[n - 1].Count;
+			}
 		}
 	}
 
-	return Element;
+	return NULL;
 }
 
 
-tJsonElement *JsonElementFind(tJsonElement *Element, tJsonPath Path, bool Create)
+tJsonElement *JsonElementFindCompiled(tJsonElement *Element, const tJsonCompiledPath *Path)
 {
 	tJsonElement **ElementReference;
+	JSON_STATS_TIMER(Timer);
 
 	if ((Element != NULL) && (Element->Type == json_TypeRoot))
 	{
-		ElementReference = JsonElementFindSubPath(&Element->Child, Element, Path, Create);
+		ElementReference = JsonElementFindCompiledPath(&Element->Child, Element, Path);
 		Element = (ElementReference != NULL) ? *ElementReference : NULL;
 	}
 	else
@@ -344,10 +1059,99 @@ tJsonElement *JsonElementFind(tJsonElement *Element, tJsonPath Path, bool Create
 		Element = NULL;
 	}
 
+	JSON_STATS_TIME(json_StatsFind, Timer);
+
 	return Element;
 }
 
 
+void JsonElementFreePrevious(tJsonElement *Element)
+{
+	tJsonElement *Previous;
+
+	if ((Element != NULL) && (Element->Parent != NULL) && (Element->Parent->Child != Element))
+	{
+		JsonElementClearIndex(Element->Parent);
+		while ((Element->Parent->Child != NULL) && (Element->Parent->Child != Element))
+		{
+			Previous = Element->Parent->Child;
+			Element->Parent->Child = Previous->Next;
+			Previous->Next = NULL;
+			JsonElementFree(&Previous);
+		}
+	}
+}
+
+
+tJsonElement *JsonElementFreeLast(tJsonElement *Element)
+{
+	tJsonElement **Child;
+	tJsonElement *Previous = NULL;
+
+	if ((Element != NULL) && (Element->Child != NULL))
+	{
+		JsonElementClearIndex(Element);
+		for (Child = &Element->Child; (*Child)->Next != NULL; Child = &(*Child)->Next)
+		{
+			Previous = *Child;
+		}
+		JsonElementFree(Child);
+	}
+
+	return Previous;
+}
+
+
+tJsonElement *JsonElementExtract(tJsonElement *Root, tJsonElement *Element)
+{
+	tJsonElement **Link;
+	tJsonElement *Parent;
+	tJsonElement *Child;
+
+	if ((Root == NULL) || (Element == NULL) || (Root->Type != json_TypeRoot))
+	{
+		return NULL;
+	}
+
+	for (Parent = Element->Parent; (Parent != NULL) && (Parent != Root); Parent = Parent->Parent)
+		;
+
+	if (Parent == NULL)
+	{
+		return NULL;
+	}
+
+	if (Element->Type == json_TypeKey)
+	{
+		Child = Element->Child;
+		Element->Child = NULL;
+	}
+	else
+	{
+		for (Link = &Element->Parent->Child; *Link != Element; Link = &(*Link)->Next)
+			;
+		*Link = Element->Next;
+		Element->Next = NULL;
+		JsonElementClearIndex(Element->Parent);
+		Child = Element;
+	}
+
+	if (JsonAllocatorCanFree(Root->Allocator))
+	{
+		JsonElementClearChild(Root);
+	}
+	JsonElementFreeIndex(Root);
+
+	Root->Child = Child;
+	for (; Child != NULL; Child = Child->Next)
+	{
+		Child->Parent = Root;
+	}
+
+	return Root->Child;
+}
+
+
 tJsonElement *JsonElementMoveChild(tJsonElement *To, tJsonElement *From)
 {
 	tJsonElement *Child;
@@ -359,6 +1163,11 @@ tJsonElement *JsonElementMoveChild(tJsonElement *To, tJsonElement *From)
 
 	if (From != To)
 	{
+		if (To->Allocator != From->Allocator)
+		{
+			return NULL;
+		}
+
 		if (((To->Type == json_TypeRoot)   && (From->Type == json_TypeRoot))   ||
 		    ((To->Type == json_TypeObject) && (From->Type == json_TypeObject)) ||
 			 ((To->Type == json_TypeKey)    && ((From->Type == json_TypeRoot) || (From->Type == json_TypeKey))) ||
@@ -368,6 +1177,8 @@ tJsonElement *JsonElementMoveChild(tJsonElement *To, tJsonElement *From)
 			{
 				JsonElementFree(&To->Child);
 			}
+			JsonElementClearIndex(To);
+			JsonElementClearIndex(From);
 
 			To->Child = From->Child;
 			From->Child = NULL;
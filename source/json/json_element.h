@@ -5,16 +5,53 @@
 #include "json_path.h"
 
 
+/**
+ * @brief The number of keys (or array children) that an object (or array) needs to have before it is indexed (to speed up \a `JsonElementFind()`)
+ */
+#define JSON_ELEMENT_INDEX_THRESHOLD 16
+
+
+/**
+ * @brief The maximum number of nested array selectors in a path that is passed to \a `JsonElementFind()` (or in a compiled path that is passed to \a `JsonElementFindCompiled()` or \a `JsonTapeFindCompiled()`)
+ */
+#define JSON_ELEMENT_FIND_DEPTH 32
+
+
+/**
+ * @brief Type used for an entry in an object key index
+ */
+typedef struct
+{
+	uint32_t             Hash;    /**< The hash value of the key name (unused for an array child) */
+	struct tJsonElement *Element; /**< The key element or array child (or \a `NULL` if the entry is not used) */
+} tJsonElementIndexEntry;
+
+
+/**
+ * @brief Type used for an object key index (a hash table of the keys of an object) or an array child index (a vector of the children of an array in order)
+ */
+typedef struct
+{
+	bool                   Valid;   /**< Indicates if the index is up to date with the object keys (it is rebuilt when it is next used if not) */
+	size_t                 Size;    /**< The number of entries in the index (a power of two) */
+	size_t                 Count;   /**< The number of keys (or array children) in the index */
+	struct tJsonElement   *Last;    /**< The last child of the object (or array) */
+	tJsonElementIndexEntry Entry[]; /**< The index entries */
+} tJsonElementIndex;
+
+
 /**
  * @brief Type used for a JSON element
  */
 typedef struct tJsonElement
 {
-	tJsonType            Type;   /**< The element type */
-	struct tJsonElement *Parent; /**< The parent element */
-	struct tJsonElement *Next;   /**< The next (sibling) element */
-	struct tJsonElement *Child;  /**< The child element */
-	tJsonString          Name;   /**< The element name */
+	tJsonType             Type;      /**< The element type */
+	struct tJsonElement  *Parent;    /**< The parent element */
+	struct tJsonElement  *Next;      /**< The next (sibling) element */
+	struct tJsonElement  *Child;     /**< The child element */
+	tJsonString           Name;      /**< The element name */
+	const tJsonAllocator *Allocator; /**< The allocator that the element is allocated from (or \a `NULL` if the element is allocated from the heap) */
+	tJsonElementIndex    *Index;     /**< The key index of an object element (or \a `NULL` if the keys are not indexed) */
 } tJsonElement;
 
 
@@ -28,6 +65,45 @@ typedef struct tJsonElement
 void JsonElementSetUp(tJsonElement *Element);
 
 
+/**
+ * @brief Sets up a JSON element that allocates all of its descendant elements from an arena
+ * @param Element   The element to set up
+ * @param ChunkSize The size (in bytes) of each chunk of memory that is allocated for the arena (zero to use a default size)
+ * @return A true value is returned if the element was set up with an arena.
+ * @return A false value is returned if the arena could not be allocated (the element is set up as per \a `JsonElementSetUp()`).
+ * @note The type of parameter \a `Element` will be set to \a `json_TypeRoot`
+ * @note The descendant elements (and their names) are not freed individually - they are all freed together when the element is cleared
+ * @note Use \a `JsonElementCleanUp()` to clean up the element (and its arena) when it is no longer required
+ */
+bool JsonElementSetUpArena(tJsonElement *Element, size_t ChunkSize);
+
+
+/**
+ * @brief Sets up a JSON element that recycles its descendant elements (and their names) when they are cleared
+ * @param Element The element to set up
+ * @return A true value is returned if the element was set up with a recycling allocator.
+ * @return A false value is returned if the recycling allocator could not be allocated (the element is set up as per \a `JsonElementSetUp()`).
+ * @note The type of parameter \a `Element` will be set to \a `json_TypeRoot`
+ * @note Cleared elements are kept for reuse (see \a `JsonRecycleFree()`) so that parsing a document of the same shape again does not allocate any memory
+ * @note Blocks of memory that are larger than \a `JSON_RECYCLE_MAX_SIZE` (2 MB), such as a very long name, are not recycled - they are allocated from (and freed to) the heap each time
+ * @note Use \a `JsonElementCleanUp()` to clean up the element (and free the recycled elements) when it is no longer required
+ */
+bool JsonElementSetUpRecycle(tJsonElement *Element);
+
+
+/**
+ * @brief Sets up a JSON element that allocates all of its descendant elements from an allocator
+ * @param Element   The element to set up
+ * @param Allocator The allocator (or \a `NULL` to use the heap as per \a `JsonElementSetUp()`)
+ * @return None
+ * @note The type of parameter \a `Element` will be set to \a `json_TypeRoot`
+ * @note The allocator is not copied - it must remain valid until the element is cleaned up.
+ * @note If the allocator does not free memory individually then the descendant elements are not freed when the element is cleared (they are freed when the owner of the allocator frees its memory).
+ * @note Use \a `JsonElementCleanUp()` to clean up the element when it is no longer required
+ */
+void JsonElementSetUpAllocator(tJsonElement *Element, const tJsonAllocator *Allocator);
+
+
 /**
  * @brief Cleans up a JSON element
  * @param Element The element to clean up
@@ -98,10 +174,67 @@ tJsonElement *JsonElementGetNext(tJsonElement *Element, bool IgnoreComments);
  * @return The last element in the path that was found
  * @return A \a `NULL` value is returned if any of the elements in the path could not be found (if \a `Create` is \a `false`) or created (if \a `Create` is \a `true`)
  * @note The type of parameter \a `Element` must be equal to \a `json_TypeRoot` - use \a `JsonElementSetUp()` to set up an appropriate element
+ * @note Objects with at least \a `JSON_ELEMENT_INDEX_THRESHOLD` keys are indexed when they are first searched (the index is kept up to date by the \a `JsonElement` functions).
+ * @note An array child can be selected by its position (for example \a `[#0]` for the first child or \a `[#-1]` for the last child - see \a `JsonPathGetPosition()`).
+ * @note Arrays with at least \a `JSON_ELEMENT_INDEX_THRESHOLD` children are indexed when a child is first selected by position (so that later selections and appends do not walk the children).
+ * @note If \a `Create` is \a `true` then a position that is one past the last child appends a new child (created from the rest of the path).
+ * @note The path is searched without recursion - a \a `NULL` value is returned if it has more than \a `JSON_ELEMENT_FIND_DEPTH` nested array selectors.
  */
 tJsonElement *JsonElementFind(tJsonElement *Element, tJsonPath Path, bool Create);
 
 
+/**
+ * @brief Finds a JSON element using a compiled path
+ * @param Element The element
+ * @param Path    The compiled path of elements to find (see \a `JsonPathCompile()`)
+ * @return The last element in the path that was found
+ * @return A \a `NULL` value is returned if any of the elements in the path could not be found
+ * @note This gives the same result as \a `JsonElementFind()` (with \a `Create` set to \a `false`) without decoding the path again - including the \a `JSON_ELEMENT_FIND_DEPTH` limit on nested array selectors
+ * @note The type of parameter \a `Element` must be equal to \a `json_TypeRoot` - use \a `JsonElementSetUp()` to set up an appropriate element
+ */
+tJsonElement *JsonElementFindCompiled(tJsonElement *Element, const tJsonCompiledPath *Path);
+
+
+/**
+ * @brief Clears the key index of a JSON object element
+ * @param Element The object element
+ * @return None
+ * @note This must be called if the name of one of the object keys is changed directly (i.e. with the \a `JsonString` functions) after the object has been searched with \a `JsonElementFind()`.
+ */
+void JsonElementClearIndex(tJsonElement *Element);
+
+
+/**
+ * @brief Frees the elements that come before an element in the list of children of its parent
+ * @param Element The element (it becomes the first child of its parent)
+ * @return None
+ * @note This is used to free the elements that have already been formatted when JSON content is streamed (see \a `JsonStreamFormat()`).
+ */
+void JsonElementFreePrevious(tJsonElement *Element);
+
+
+/**
+ * @brief Frees the last child of an element (and all of its children)
+ * @param Element The element
+ * @return The child element that is now the last child of the element
+ * @return A \a `NULL` value is returned if the element does not have any children left
+ * @note This is used to free a key when its value is skipped by a filter (see \a `JsonParseSetUpFilter()`).
+ */
+tJsonElement *JsonElementFreeLast(tJsonElement *Element);
+
+
+/**
+ * @brief Replaces the children of a root element with one of its descendants
+ * @param Root    The root element
+ * @param Element The descendant element to keep (if this is a key element then its children are kept instead)
+ * @return The first child of the root element
+ * @return A \a `NULL` value is returned if the element is not a descendant of the root element
+ * @note All of the other elements are freed (if the elements are allocated from an arena then they are only freed when the arena is cleared).
+ * @note This is used to keep just the element that is found by \a `JsonReadFind()`.
+ */
+tJsonElement *JsonElementExtract(tJsonElement *Root, tJsonElement *Element);
+
+
 /**
  * @brief Moves the child elements from one element to another
  * @param To   The element to move the children to
@@ -110,6 +243,7 @@ tJsonElement *JsonElementFind(tJsonElement *Element, tJsonPath Path, bool Create
  * @return A \a `NULL` value is returned if the children could not be moved
  * @note If the parameter \a `To` has any children then these will get freed
  * @note The parameter \a `From` will not have any children after they have been moved (they are not shared)
+ * @note The children can only be moved if both elements allocate their elements from the same place (the heap or the same arena)
  */
 tJsonElement *JsonElementMoveChild(tJsonElement *To, tJsonElement *From);
 
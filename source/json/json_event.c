@@ -0,0 +1,172 @@
+#include "json_event.h"
+
+
+static bool JsonEventAdd(void *Context, const tJsonElement *Element, bool End)
+{
+	tJsonEventParse *Parse = (tJsonEventParse *)Context;
+	tJsonEvent *Event;
+
+	if (Parse->QueueCount == JSON_EVENT_QUEUE_SIZE)
+	{
+		return false;
+	}
+
+	Event = &Parse->Queue[Parse->QueueCount];
+	switch (Element->Type)
+	{
+		case json_TypeObject:
+			Event->Type = End ? json_EventObjectEnd : json_EventObjectStart;
+		break;
+
+		case json_TypeArray:
+			Event->Type = End ? json_EventArrayEnd : json_EventArrayStart;
+		break;
+
+		case json_TypeKey:
+			Event->Type = json_EventKey;
+		break;
+
+		case json_TypeValueString:
+			Event->Type = json_EventString;
+		break;
+
+		case json_TypeValueLiteral:
+			Event->Type = json_EventLiteral;
+		break;
+
+		case json_TypeComment:
+			Event->Type = json_EventComment;
+		break;
+
+		default:
+			return false;
+	}
+
+	if ((Event->Type == json_EventObjectEnd) || (Event->Type == json_EventArrayEnd))
+	{
+		Parse->Depth--;
+	}
+
+	Event->Content = (Element->Name.Content != NULL) ? Element->Name.Content : (const uint8_t *)"";
+	Event->Length = Element->Name.Length;
+	Event->Depth = Parse->Depth;
+	Parse->QueueCount++;
+
+	if ((Event->Type == json_EventObjectStart) || (Event->Type == json_EventArrayStart))
+	{
+		Parse->Depth++;
+	}
+
+	return true;
+}
+
+
+static bool JsonEventGet(tJsonEventParse *Parse, tJsonEvent *Event)
+{
+	if (Parse->QueueIndex == Parse->QueueCount)
+	{
+		Parse->QueueIndex = 0;
+		Parse->QueueCount = 0;
+		return false;
+	}
+
+	*Event = Parse->Queue[Parse->QueueIndex];
+	Parse->QueueIndex++;
+
+	return true;
+}
+
+
+static int JsonEventGetState(const tJsonEventParse *Parse)
+{
+	if (Parse->Parse.State == json_ParseError)
+	{
+		return JSON_EVENT_ERROR;
+	}
+	else if (Parse->Parse.State == json_ParseComplete)
+	{
+		return JSON_EVENT_COMPLETE;
+	}
+	else
+	{
+		return JSON_EVENT_INCOMPLETE;
+	}
+}
+
+
+void JsonEventSetUp(tJsonEventParse *Parse, bool StripComments)
+{
+	JsonElementSetUpRecycle(&Parse->Root);
+	JsonParseSetUpCallback(&Parse->Parse, StripComments, &Parse->Root, JsonEventAdd, Parse);
+	Parse->Depth = 0;
+	Parse->QueueIndex = 0;
+	Parse->QueueCount = 0;
+}
+
+
+void JsonEventCleanUp(tJsonEventParse *Parse)
+{
+	JsonParseCleanUp(&Parse->Parse);
+	JsonElementCleanUp(&Parse->Root);
+	Parse->Depth = 0;
+	Parse->QueueIndex = 0;
+	Parse->QueueCount = 0;
+}
+
+
+int JsonEventNext(tJsonEventParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEvent *Event)
+{
+	tJsonElement *Element;
+
+	if (JsonEventGet(Parse, Event))
+	{
+		return JSON_EVENT_AVAILABLE;
+	}
+
+	JsonParse(&Parse->Parse, UtfType, Content, Size, Offset);
+
+	if (JsonEventGet(Parse, Event))
+	{
+		return JSON_EVENT_AVAILABLE;
+	}
+
+	Element = Parse->Parse.Element;
+	if ((JsonEventGetState(Parse) == JSON_EVENT_INCOMPLETE) && (Element != NULL) && !JsonParseIsNameComplete(&Parse->Parse, Element) && JsonStringIsView(&Element->Name) && !JsonStringReserve(&Element->Name, JsonStringGetLength(&Element->Name)))
+	{
+		Parse->Parse.State = json_ParseError;
+	}
+
+	return JsonEventGetState(Parse);
+}
+
+
+int JsonEventNextUtf8(tJsonEventParse *Parse, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEvent *Event)
+{
+	return JsonEventNext(Parse, json_Utf8, Content, Size, Offset, Event);
+}
+
+
+int JsonEventParse(tJsonEventParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEventCallback Callback, void *Context)
+{
+	tJsonEvent Event;
+	size_t DiscardOffset = 0;
+	int State;
+
+	if (Offset == NULL)
+	{
+		Offset = &DiscardOffset;
+	}
+
+	while ((State = JsonEventNext(Parse, UtfType, Content, Size, Offset, &Event)) == JSON_EVENT_AVAILABLE)
+	{
+		if (!Callback(Context, &Event))
+		{
+			Parse->Parse.State = json_ParseError;
+			Parse->QueueIndex = 0;
+			Parse->QueueCount = 0;
+			return JSON_EVENT_ERROR;
+		}
+	}
+
+	return State;
+}
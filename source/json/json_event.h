@@ -0,0 +1,148 @@
+#ifndef JSON_EVENT_H
+#define JSON_EVENT_H
+
+#include "json_parse.h"
+
+
+/**
+ * @brief The maximum number of events that can be produced by one character of JSON content
+ */
+#define JSON_EVENT_QUEUE_SIZE 2
+
+
+/**
+ * @brief Enumeration used to define the different types of parsing event
+ */
+typedef enum
+{
+	json_EventObjectStart, /**< The start of an object */
+	json_EventObjectEnd,   /**< The end of an object */
+	json_EventArrayStart,  /**< The start of an array */
+	json_EventArrayEnd,    /**< The end of an array */
+	json_EventKey,         /**< An object key (the content is the unescaped key string) */
+	json_EventString,      /**< A string value (the content is the unescaped string) */
+	json_EventLiteral,     /**< A literal value (the content is the literal, e.g. a number, true, false or null) */
+	json_EventComment,     /**< A line comment, or one line of a block comment (the content is the comment text) */
+} tJsonEventType;
+
+
+/**
+ * @brief Type used for a parsing event
+ * @note The content is only valid until the next event is requested from the parser (or until the parsed JSON content is changed or freed).
+ */
+typedef struct
+{
+	tJsonEventType Type;    /**< The type of event */
+	const uint8_t *Content; /**< The UTF-8 encoded content of a key, string, literal or comment (not null terminated) */
+	size_t         Length;  /**< The length of the content (in bytes) - zero for the start and end of an object or array */
+	size_t         Depth;   /**< The nesting depth of the event (zero for a top level value, one for the keys and values inside it, etc.) */
+} tJsonEvent;
+
+
+/**
+ * @brief Type used for a function that is called for each parsing event
+ * @param Context The context passed to \a `JsonEventParse()`
+ * @param Event   The parsing event
+ * @return A true value should be returned to continue parsing.
+ * @return A false value should be returned to stop parsing (with an error).
+ */
+typedef bool (* tJsonEventCallback)(void *Context, const tJsonEvent *Event);
+
+
+/**
+ * @brief Type used for parsing JSON content into events (without building a tree of elements)
+ * @note The events are reported by a JSON content parser (see \a `JsonParseSetUpCallback()`) - so the content is checked in exactly the same way as it is when elements are read.
+ * @note The parser only holds the elements on the path to the element being parsed (and the content of the key, string, literal or comment being parsed).
+ * @note The parser must not be moved once it has been set up (as the JSON content parser refers to its root element).
+ */
+typedef struct
+{
+	tJsonParse   Parse;                        /**< The JSON content parser */
+	tJsonElement Root;                         /**< The root of the elements that are being parsed */
+	size_t       Depth;                        /**< The current nesting depth (the number of enclosing objects and arrays) */
+	tJsonEvent   Queue[JSON_EVENT_QUEUE_SIZE]; /**< The events that have been parsed but not yet returned */
+	size_t       QueueIndex;                   /**< The index of the next event to return from the queue */
+	size_t       QueueCount;                   /**< The number of events in the queue */
+} tJsonEventParse;
+
+
+/**
+ * @name JsonEventNext return codes
+ * @{
+ */
+#define JSON_EVENT_ERROR      -1 /**< A parsing error occurred */
+#define JSON_EVENT_COMPLETE   0  /**< Parsing is complete */
+#define JSON_EVENT_INCOMPLETE 1  /**< Parsing is incomplete (more content is required) */
+#define JSON_EVENT_AVAILABLE  2  /**< An event was returned */
+/** @} */
+
+
+/**
+ * @brief Sets up a JSON event parser
+ * @param Parse         The JSON event parser to set up
+ * @param StripComments Indicates whether to strip comments (no comment events are produced) or keep them
+ * @return None
+ * @note Use \a `JsonEventCleanUp()` to clean up the parser when it is no longer required
+ */
+void JsonEventSetUp(tJsonEventParse *Parse, bool StripComments);
+
+
+/**
+ * @brief Cleans up a JSON event parser
+ * @param Parse The JSON event parser to clean up
+ * @return None
+ */
+void JsonEventCleanUp(tJsonEventParse *Parse);
+
+
+/**
+ * @brief Parses UTF-8 encoded JSON content up to the next event
+ * @param Parse   The JSON event parser
+ * @param Content The UTF-8 encoded JSON content
+ * @param Size    The size of the JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is parsed
+ * @param Event   Used to return the next event
+ * @return `JSON_EVENT_ERROR`      is returned if there was a parsing error.
+ * @return `JSON_EVENT_COMPLETE`   is returned if the parsing is complete.
+ * @return `JSON_EVENT_INCOMPLETE` is returned if all of the content was parsed without producing another event.
+ * @return `JSON_EVENT_AVAILABLE`  is returned if an event was returned (call the function again with the same content and offset to continue parsing).
+ * @note The parsing should be completed by parsing a null character.
+ * @note The content of an event is a view of the parsed JSON content if it was parsed in one go without any escaped characters - otherwise it is copied.
+ * @note Any content that has been parsed when \a `JSON_EVENT_INCOMPLETE` is returned is copied by the parser (so the JSON content can then be changed).
+ */
+int JsonEventNextUtf8(tJsonEventParse *Parse, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEvent *Event);
+
+
+/**
+ * @brief Parses JSON content using a UTF encoding up to the next event
+ * @param Parse   The JSON event parser
+ * @param UtfType The type of UTF to use to decode the content
+ * @param Content The JSON content
+ * @param Size    The size of the JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is parsed
+ * @param Event   Used to return the next event
+ * @return The same values as \a `JsonEventNextUtf8()` are returned.
+ * @note The parsing should be completed by parsing an encoded null character.
+ * @note The content of an event is always copied unless the content is UTF-8 encoded.
+ */
+int JsonEventNext(tJsonEventParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEvent *Event);
+
+
+/**
+ * @brief Parses JSON content using a UTF encoding and passes each event to a callback function
+ * @param Parse    The JSON event parser
+ * @param UtfType  The type of UTF to use to decode the content
+ * @param Content  The JSON content
+ * @param Size     The size of the JSON content
+ * @param Offset   Used to pass and return the offset where the JSON content is parsed
+ * @param Callback The function to call for each event
+ * @param Context  The context to pass to the callback function
+ * @return `JSON_EVENT_ERROR`      is returned if there was a parsing error (or the callback function stopped the parsing).
+ * @return `JSON_EVENT_COMPLETE`   is returned if the parsing is complete.
+ * @return `JSON_EVENT_INCOMPLETE` is returned if parsing is not yet complete.
+ * @note The parsing should be completed by parsing an encoded null character.
+ */
+int JsonEventParse(tJsonEventParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Size, size_t *Offset, tJsonEventCallback Callback, void *Context);
+
+
+#endif
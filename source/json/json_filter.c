@@ -0,0 +1,314 @@
+#include <string.h>
+#include "json_filter.h"
+#include "json_stats.h"
+
+
+static bool JsonFilterAddTail(tJsonFilter *Filter, tJsonPath Path)
+{
+	tJsonPath *Tail;
+	size_t TailSize;
+
+	if (Filter->TailCount == Filter->TailSize)
+	{
+		TailSize = (Filter->TailSize != 0) ? Filter->TailSize * 2 : 16;
+		Tail = (tJsonPath *)JSON_STATS_REALLOC(json_StatsFilter, Filter->Tail, TailSize * sizeof(tJsonPath));
+		if (Tail == NULL)
+		{
+			return false;
+		}
+		Filter->Tail = Tail;
+		Filter->TailSize = TailSize;
+	}
+
+	Filter->Tail[Filter->TailCount] = Path;
+	Filter->TailCount++;
+
+	return true;
+}
+
+
+static bool JsonFilterAddFrame(tJsonFilter *Filter, const tJsonElement *Element, size_t TailStart, bool Full)
+{
+	tJsonFilterFrame *Frame;
+	size_t FrameSize;
+
+	if (Filter->FrameCount == Filter->FrameSize)
+	{
+		FrameSize = (Filter->FrameSize != 0) ? Filter->FrameSize * 2 : 16;
+		Frame = (tJsonFilterFrame *)JSON_STATS_REALLOC(json_StatsFilter, Filter->Frame, FrameSize * sizeof(tJsonFilterFrame));
+		if (Frame == NULL)
+		{
+			return false;
+		}
+		Filter->Frame = Frame;
+		Filter->FrameSize = FrameSize;
+	}
+
+	Frame = &Filter->Frame[Filter->FrameCount];
+	Frame->Element = Element;
+	Frame->TailStart = TailStart;
+	Frame->TailEnd = Filter->TailCount;
+	Frame->Count = 0;
+	Frame->Full = Full;
+	Filter->FrameCount++;
+
+	return true;
+}
+
+
+static bool JsonFilterIsWithin(const tJsonElement *Ancestor, const tJsonElement *Element)
+{
+	for (; Element != NULL; Element = Element->Parent)
+	{
+		if (Element == Ancestor)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+static bool JsonFilterIsKey(tJsonPath Component, tJsonString *Name)
+{
+	tJsonString KeyName;
+	bool ok;
+
+	if ((Component.Length == 0) || (memchr(Component.Value, '\\', Component.Length) == NULL))
+	{
+		return JsonPathCompareString(Component, Name);
+	}
+
+	JsonStringSetUp(&KeyName);
+	ok = JsonPathGetString(Component, &KeyName) && (KeyName.Length == Name->Length) && ((KeyName.Length == 0) || (memcmp(KeyName.Content, Name->Content, KeyName.Length) == 0));
+	JsonStringCleanUp(&KeyName);
+
+	return ok;
+}
+
+
+static tJsonFilterResult JsonFilterApplyValue(tJsonFilter *Filter, tJsonPath Path, tJsonType Type)
+{
+	tJsonPath Component;
+	tJsonType ComponentType;
+	size_t Length;
+
+	if (Path.Length == 0)
+	{
+		return json_FilterFull;
+	}
+
+	Length = JsonPathGetComponent(Path, &ComponentType, &Component);
+	if ((Length == 0) || (ComponentType != Type))
+	{
+		return json_FilterSkip;
+	}
+	else if (ComponentType == json_TypeObject)
+	{
+		Path = JsonPathRight(Path, Length);
+		return ((Path.Length != 0) && JsonFilterAddTail(Filter, Path)) ? json_FilterKeep : json_FilterFull;
+	}
+	else if (ComponentType == json_TypeArray)
+	{
+		return JsonFilterAddTail(Filter, Path) ? json_FilterKeep : json_FilterFull;
+	}
+	else if ((ComponentType == json_TypeValueString) || (ComponentType == json_TypeValueLiteral))
+	{
+		return json_FilterFull;
+	}
+
+	return json_FilterSkip;
+}
+
+
+static tJsonFilterResult JsonFilterApplyKey(tJsonFilter *Filter, tJsonPath *Path, tJsonElement *Key, tJsonType Type)
+{
+	tJsonFilterResult Result;
+	tJsonPath Component;
+	tJsonPath Tail;
+	tJsonType ComponentType;
+	size_t Length;
+
+	Length = JsonPathGetComponent(*Path, &ComponentType, &Component);
+	if ((Length == 0) || (ComponentType != json_TypeKey) || !JsonFilterIsKey(Component, &Key->Name))
+	{
+		return json_FilterSkip;
+	}
+
+	Tail = JsonPathRight(*Path, Length);
+	Path->Length = 0;
+	Result = JsonFilterApplyValue(Filter, Tail, Type);
+
+	return (Result > json_FilterShell) ? Result : json_FilterShell;
+}
+
+
+static tJsonFilterResult JsonFilterApplyArray(tJsonFilter *Filter, tJsonPath Path, size_t Index, tJsonType Type)
+{
+	tJsonFilterResult Result;
+	tJsonFilterResult RestResult;
+	tJsonPath Component;
+	tJsonType ComponentType;
+	ptrdiff_t Position;
+	size_t Length;
+
+	Length = JsonPathGetComponent(Path, &ComponentType, &Component);
+	if ((Length == 0) || (ComponentType != json_TypeArray))
+	{
+		return json_FilterSkip;
+	}
+
+	Path = JsonPathRight(Path, Length);
+
+	if (!JsonPathGetPosition(Component, &Position))
+	{
+		Result = JsonFilterApplyValue(Filter, Component, Type);
+		RestResult = JsonFilterApplyValue(Filter, Path, Type);
+		return (RestResult > Result) ? RestResult : Result;
+	}
+	else if (Position < 0)
+	{
+		Result = JsonFilterApplyValue(Filter, Path, Type);
+		return (Result > json_FilterShell) ? Result : json_FilterShell;
+	}
+	else if (Index < (size_t)Position)
+	{
+		return json_FilterShell;
+	}
+	else if (Index == (size_t)Position)
+	{
+		return JsonFilterApplyValue(Filter, Path, Type);
+	}
+
+	return json_FilterSkip;
+}
+
+
+void JsonFilterSetUp(tJsonFilter *Filter, const tJsonPath *Path, size_t PathCount)
+{
+	Filter->Path = Path;
+	Filter->PathCount = PathCount;
+	Filter->Frame = NULL;
+	Filter->FrameCount = 0;
+	Filter->FrameSize = 0;
+	Filter->Tail = NULL;
+	Filter->TailCount = 0;
+	Filter->TailSize = 0;
+	Filter->Result = json_FilterSkip;
+}
+
+
+void JsonFilterCleanUp(tJsonFilter *Filter)
+{
+	JSON_STATS_FREE(json_StatsFilter, Filter->Frame);
+	JSON_STATS_FREE(json_StatsFilter, Filter->Tail);
+	Filter->Path = NULL;
+	Filter->PathCount = 0;
+	Filter->Frame = NULL;
+	Filter->FrameCount = 0;
+	Filter->FrameSize = 0;
+	Filter->Tail = NULL;
+	Filter->TailCount = 0;
+	Filter->TailSize = 0;
+	Filter->Result = json_FilterSkip;
+}
+
+
+bool JsonFilterStart(tJsonFilter *Filter, const tJsonElement *Root)
+{
+	size_t n;
+
+	Filter->FrameCount = 0;
+	Filter->TailCount = 0;
+	Filter->Result = json_FilterSkip;
+
+	for (n = 0; n < Filter->PathCount; n++)
+	{
+		if (!JsonFilterAddTail(Filter, Filter->Path[n]))
+		{
+			return false;
+		}
+	}
+
+	return JsonFilterAddFrame(Filter, Root, 0, false);
+}
+
+
+tJsonFilterResult JsonFilterValue(tJsonFilter *Filter, tJsonElement *Parent, tJsonType Type)
+{
+	tJsonFilterFrame *Frame;
+	tJsonFilterResult Result;
+	tJsonFilterResult TailResult;
+	const tJsonElement *Container;
+	size_t n;
+
+	Container = (Parent->Type == json_TypeKey) ? Parent->Parent : Parent;
+
+	while ((Filter->FrameCount > 1) && !JsonFilterIsWithin(Filter->Frame[Filter->FrameCount - 1].Element, Container))
+	{
+		Filter->FrameCount--;
+	}
+
+	if (Filter->FrameCount == 0)
+	{
+		Filter->Result = json_FilterFull;
+		return Filter->Result;
+	}
+
+	Frame = &Filter->Frame[Filter->FrameCount - 1];
+	Filter->TailCount = Frame->TailEnd;
+
+	if (Frame->Full || (Frame->Element != Container))
+	{
+		Filter->Result = json_FilterFull;
+		return Filter->Result;
+	}
+
+	for (Result = json_FilterSkip, n = Frame->TailStart; (n < Frame->TailEnd) && (Result != json_FilterFull); n++)
+	{
+		if (Container->Type == json_TypeObject)
+		{
+			TailResult = JsonFilterApplyKey(Filter, &Filter->Tail[n], Parent, Type);
+		}
+		else if (Container->Type == json_TypeArray)
+		{
+			TailResult = JsonFilterApplyArray(Filter, Filter->Tail[n], Frame->Count, Type);
+		}
+		else
+		{
+			TailResult = JsonFilterApplyValue(Filter, Filter->Tail[n], Type);
+		}
+
+		Result = (TailResult > Result) ? TailResult : Result;
+	}
+
+	if (Container->Type == json_TypeArray)
+	{
+		Frame->Count++;
+	}
+
+	if ((Result == json_FilterShell) && (Type != json_TypeObject) && (Type != json_TypeArray))
+	{
+		Result = json_FilterFull;
+	}
+
+	Filter->Result = Result;
+
+	return Result;
+}
+
+
+bool JsonFilterEnter(tJsonFilter *Filter, const tJsonElement *Element)
+{
+	if ((Filter->FrameCount != 0) && Filter->Frame[Filter->FrameCount - 1].Full && JsonFilterIsWithin(Filter->Frame[Filter->FrameCount - 1].Element, Element))
+	{
+		return true;
+	}
+	else if ((Filter->Result == json_FilterKeep) || (Filter->Result == json_FilterFull))
+	{
+		return JsonFilterAddFrame(Filter, Element, (Filter->FrameCount != 0) ? Filter->Frame[Filter->FrameCount - 1].TailEnd : 0, Filter->Result == json_FilterFull);
+	}
+
+	return true;
+}
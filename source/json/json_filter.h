@@ -0,0 +1,104 @@
+#ifndef JSON_FILTER_H
+#define JSON_FILTER_H
+
+#include "json_element.h"
+
+
+/**
+ * @brief Enumeration used to define what a filter requires for a value that is being parsed
+ */
+typedef enum
+{
+	json_FilterSkip,  /**< The value is not required (it is skipped without allocating any elements) */
+	json_FilterShell, /**< Only the value element is required (its children are skipped) so that the positions of the array children that follow it are kept */
+	json_FilterKeep,  /**< The value element is required (its children are filtered) */
+	json_FilterFull   /**< The value element and all of its children are required */
+} tJsonFilterResult;
+
+
+/**
+ * @brief Type used for an object or array element that is being parsed with a filter
+ */
+typedef struct
+{
+	const tJsonElement *Element;   /**< The object or array element (or the root element) */
+	size_t              TailStart; /**< The index of the first filter path tail that applies to the children of the element */
+	size_t              TailEnd;   /**< The index after the last filter path tail that applies to the children of the element */
+	size_t              Count;     /**< The number of array children that have been parsed so far */
+	bool                Full;      /**< Indicates whether all of the children of the element are required */
+} tJsonFilterFrame;
+
+
+/**
+ * @brief Type used for a set of paths that selects the elements that are allocated by a parser (see \a `JsonParseSetUpFilter()`)
+ * @note The parser only allocates the elements that match one of the paths (with all of their children) and the ancestors of those elements.
+ * @note The memory used by the filter only depends on the nesting depth of the elements that are allocated and the number of paths.
+ * @note If an object has duplicate keys then a path only uses the first one (as \a `JsonElementFind()` does) - it is kept (as a shell if its value does not match the rest of the path) and the later ones are skipped.
+ */
+typedef struct
+{
+	const tJsonPath  *Path;       /**< The filter paths */
+	size_t            PathCount;  /**< The number of filter paths */
+	tJsonFilterFrame *Frame;      /**< The object and array elements that are being parsed (innermost last) */
+	size_t            FrameCount; /**< The number of frames */
+	size_t            FrameSize;  /**< The number of frames that have been allocated */
+	tJsonPath        *Tail;       /**< The filter path tails that apply to the children of each frame */
+	size_t            TailCount;  /**< The number of tails (including the tails for the value that is being parsed) */
+	size_t            TailSize;   /**< The number of tails that have been allocated */
+	tJsonFilterResult Result;     /**< The result for the value that is being parsed */
+} tJsonFilter;
+
+
+/**
+ * @brief Sets up a filter
+ * @param Filter    The filter to set up
+ * @param Path      The paths of the elements to allocate (see \a `JsonElementFind()`)
+ * @param PathCount The number of paths
+ * @return None
+ * @note The paths must remain valid until the filter is cleaned up.
+ * @note An array selector that ends a path needs every child of the array (it is not known which child matches until it has been parsed) and a negative array position needs a shell of every child.
+ * @note Use \a `JsonFilterCleanUp()` to clean up the filter when it is no longer required
+ */
+void JsonFilterSetUp(tJsonFilter *Filter, const tJsonPath *Path, size_t PathCount);
+
+
+/**
+ * @brief Cleans up a filter
+ * @param Filter The filter to clean up
+ * @return None
+ */
+void JsonFilterCleanUp(tJsonFilter *Filter);
+
+
+/**
+ * @brief Starts filtering the elements that are parsed into a root element
+ * @param Filter The filter
+ * @param Root   The root element
+ * @return A true value is returned if the filter was started.
+ * @return A false value is returned if there was not enough memory to start the filter.
+ */
+bool JsonFilterStart(tJsonFilter *Filter, const tJsonElement *Root);
+
+
+/**
+ * @brief Gets what a filter requires for a value that is about to be parsed
+ * @param Filter The filter
+ * @param Parent The parent of the value (a key element for the value of an object key)
+ * @param Type   The type of the value
+ * @return The filter result for the value (a key element that is the parent of a skipped value is not required either).
+ * @note If the value is an object or array that is kept then \a `JsonFilterEnter()` must be called once its element has been allocated.
+ */
+tJsonFilterResult JsonFilterValue(tJsonFilter *Filter, tJsonElement *Parent, tJsonType Type);
+
+
+/**
+ * @brief Enters the object or array element of the value that was passed to \a `JsonFilterValue()`
+ * @param Filter  The filter
+ * @param Element The object or array element
+ * @return A true value is returned if the element was entered.
+ * @return A false value is returned if there was not enough memory to enter the element.
+ */
+bool JsonFilterEnter(tJsonFilter *Filter, const tJsonElement *Element);
+
+
+#endif
@@ -1,5 +1,8 @@
+#include <string.h>
 #include "json_character.h"
 #include "json_format.h"
+#include "json_scan.h"
+#include "json_stats.h"
 
 
 #define JSON_FORMAT_INDENT_SPACE_COUNT 3
@@ -605,12 +608,121 @@ int JsonFormatCharacter(tJsonFormat *Format, tJsonCharacter *Character)
 }
 
 
+size_t JsonFormatUtf8Span(tJsonFormat *Format, uint8_t *Content, size_t Size, size_t Offset)
+{
+	const uint8_t *Name;
+	tJsonCharacter Character;
+	size_t DecodeLength;
+	size_t Available;
+	size_t Length;
+
+	Available = Size - JSON_FORMAT_MIN_SIZE + 1 - Offset;
+
+	if (((Format->State == json_FormatValueStart) || (Format->State == json_FormatValueEnd) || (Format->State == json_FormatComment)) && !Format->NewLine && (Format->SpaceCount != 0))
+	{
+		Length = (Format->SpaceCount < Available) ? Format->SpaceCount : Available;
+		memset(&Content[Offset], ' ', Length);
+		Format->SpaceCount = Format->SpaceCount - Length;
+		return Length;
+	}
+	else if ((Format->State != json_FormatKey) && (Format->State != json_FormatValueString) && (Format->State != json_FormatValueLiteral))
+	{
+		return 0;
+	}
+	else if (Format->NameIndex == Format->Element->Name.Length)
+	{
+		return 0;
+	}
+
+	Name = &Format->Element->Name.Content[Format->NameIndex];
+	Length = Format->Element->Name.Length - Format->NameIndex;
+	if (Length > Available)
+	{
+		Length = Available;
+	}
+
+	if (Format->State != json_FormatValueLiteral)
+	{
+		for (Available = Length, Length = 0; Length < Available; Length = Length + DecodeLength)
+		{
+			Length = Length + JsonScanString(&Name[Length], Available - Length);
+			if ((Length == Available) || (Name[Length] < 0x80))
+			{
+				break;
+			}
+			DecodeLength = JsonUtf8DecodeNext(Name, Available, Length, &Character);
+			if (DecodeLength == 0)
+			{
+				break;
+			}
+		}
+	}
+
+	while ((Length != 0) && (Format->NameIndex + Length < Format->Element->Name.Length) && ((Name[Length] & 0xC0) == 0x80))
+	{
+		Length--;
+	}
+
+	memcpy(&Content[Offset], Name, Length);
+	Format->NameIndex = Format->NameIndex + Length;
+
+	return Length;
+}
+
+
+int JsonFormatUtf8(tJsonFormat *Format, uint8_t *Content, size_t Size, size_t *Offset)
+{
+	tJsonCharacter Character;
+	size_t DiscardOffset = 0;
+	size_t Length;
+	int State = JSON_FORMAT_INCOMPLETE;
+	JSON_STATS_TIMER(Timer);
+
+	if (Size < JSON_FORMAT_MIN_SIZE)
+	{
+		return JSON_FORMAT_ERROR;
+	}
+
+	if (Offset == NULL)
+	{
+		Offset = &DiscardOffset;
+	}
+
+	while ((State == JSON_FORMAT_INCOMPLETE) && (*Offset <= Size - JSON_FORMAT_MIN_SIZE))
+	{
+		if ((Format->Element != NULL) && ((Length = JsonFormatUtf8Span(Format, Content, Size, *Offset)) != 0))
+		{
+			*Offset = *Offset + Length;
+			continue;
+		}
+
+		State = JsonFormatCharacter(Format, &Character);
+		Length = (State == JSON_FORMAT_INCOMPLETE) ? JsonUtf8Encode(Content, Size, *Offset, Character) : 0;
+		if ((State == JSON_FORMAT_INCOMPLETE) && (Length == 0))
+		{
+			State = JSON_FORMAT_ERROR;
+		}
+		*Offset = *Offset + Length;
+	}
+
+	JSON_STATS_TIME(json_StatsFormat, Timer);
+
+	return State;
+}
+
+
 int JsonFormat(tJsonFormat *Format, tJsonUtfType UtfType, uint8_t *Content, size_t Size, size_t *Offset)
 {
 	tJsonCharacter Character;
 	size_t DiscardOffset = 0;
 	size_t EncodeLength;
 	int State = JSON_FORMAT_INCOMPLETE;
+	JSON_STATS_TIMER(Timer);
+
+	if (UtfType == json_Utf8)
+	{
+		return JsonFormatUtf8(Format, Content, Size, Offset);
+	}
 
 	if (Size < JSON_FORMAT_MIN_SIZE)
 	{
@@ -632,5 +744,7 @@ int JsonFormat(tJsonFormat *Format, tJsonUtfType UtfType, uint8_t *Content, size
 		}
 	}
 
+	JSON_STATS_TIME(json_StatsFormat, Timer);
+
 	return State;
 }
@@ -140,6 +140,34 @@ int JsonFormatCharacter(tJsonFormat *Format, tJsonCharacter *Character);
 #define JSON_FORMAT_MIN_SIZE 4
 
 
+/**
+ * @brief Formats UTF-8 encoded JSON content
+ * @param Format  The JSON content formatter
+ * @param Content Used to return the UTF-8 encoded JSON content
+ * @param Size    The size of the encoded JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is formatted
+ * @return \a `JSON_FORMAT_ERROR`      is returned if there was a formatting error
+ * @return \a `JSON_FORMAT_COMPLETE`   is returned if the formatting is complete
+ * @return \a `JSON_FORMAT_INCOMPLETE` is returned if formatting is not yet complete
+ * @note The \a `Content` size should be at least \a `JSON_FORMAT_MIN_SIZE` in bytes
+ * @note This gives the same result as \a `JsonFormat()` with a \a `json_Utf8` encoding (which uses this function) - runs of characters that do not need escaping, literal values and indentation spaces are copied to the content in one go.
+ */
+int JsonFormatUtf8(tJsonFormat *Format, uint8_t *Content, size_t Size, size_t *Offset);
+
+
+/**
+ * @brief Formats a run of UTF-8 encoded JSON content that can be copied in one go
+ * @param Format  The JSON content formatter
+ * @param Content Used to return the UTF-8 encoded JSON content
+ * @param Size    The size of the encoded JSON content
+ * @param Offset  The offset where the JSON content is formatted
+ * @return The length of the formatted run (zero if the next character must be formatted using \a `JsonFormatCharacter()`)
+ * @note The run is either the indentation spaces or the characters of a key, string or literal name that do not need escaping.
+ * @note This is used by \a `JsonFormatUtf8()` and lets other formatting loops (such as \a `JsonStreamFormat()`) use the same fast path.
+ */
+size_t JsonFormatUtf8Span(tJsonFormat *Format, uint8_t *Content, size_t Size, size_t Offset);
+
+
 /**
  * @brief Formats JSON content using a UTF encoding
  * @param Format   The JSON content formatter
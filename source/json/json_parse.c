@@ -1,5 +1,21 @@
+#include <string.h>
 #include "json_character.h"
 #include "json_parse.h"
+#include "json_scan.h"
+#include "json_stats.h"
+
+
+static bool JsonParseReport(tJsonParse *Parse, bool End)
+{
+	if (Parse->Callback == NULL)
+	{
+		return true;
+	}
+
+	Parse->Reported = true;
+
+	return Parse->Callback(Parse->Context, Parse->Element, End);
+}
 
 
 static bool JsonParseAllocateElement(tJsonParse *Parse, tJsonType Type)
@@ -17,6 +33,15 @@ static bool JsonParseAllocateElement(tJsonParse *Parse, tJsonType Type)
 		Parse->Element = Parse->Element->Next;
 	}
 
+	if (ok && (Parse->Callback != NULL))
+	{
+		JsonElementFreePrevious(Parse->Element);
+		if ((Type == json_TypeObject) || (Type == json_TypeArray))
+		{
+			ok = JsonParseReport(Parse, false);
+		}
+	}
+
 	return ok;
 }
 
@@ -43,6 +68,12 @@ static tJsonParseState JsonParseSetCommentState(tJsonParse *Parse, tJsonParseSta
 }
 
 
+static bool JsonParseIsStripping(const tJsonParse *Parse)
+{
+	return Parse->StripComments || (Parse->CommentState == json_ParseSkip) || (Parse->CommentState == json_ParseSkipEnd);
+}
+
+
 static tJsonParseState JsonParseUtf16Escape(tJsonParse *Parse, tJsonCharacter Character)
 {
 	if (Character == '\\')
@@ -130,8 +161,11 @@ static tJsonParseState JsonParseKey(tJsonParse *Parse, tJsonCharacter Character)
 	}
 	else if (Character == '"')
 	{
-		Parse->AllocateChild = true;
-		return json_ParseKeyEnd;
+		if (JsonParseReport(Parse, false))
+		{
+			Parse->AllocateChild = true;
+			return json_ParseKeyEnd;
+		}
 	}
 	else if (JsonStringAddCharacter(&Parse->Element->Name, Character))
 	{
@@ -161,7 +195,7 @@ static tJsonParseState JsonParseKeyStart(tJsonParse *Parse, tJsonCharacter Chara
 			}
 			Parse->Element = Parse->Element->Parent;
 		}
-		if (Parse->Element->Type == json_TypeObject)
+		if ((Parse->Element->Type == json_TypeObject) && JsonParseReport(Parse, true))
 		{
 			return json_ParseValueEnd;
 		}
@@ -209,8 +243,11 @@ static tJsonParseState JsonParseValueString(tJsonParse *Parse, tJsonCharacter Ch
 	}
 	else if (Character == '"')
 	{
-		return json_ParseValueEnd;
-	}	
+		if (JsonParseReport(Parse, false))
+		{
+			return json_ParseValueEnd;
+		}
+	}
 	else if (JsonStringAddCharacter(&Parse->Element->Name, Character))
 	{
 		return json_ParseValueString;
@@ -246,7 +283,10 @@ static tJsonParseState JsonParseValueEnd(tJsonParse *Parse, tJsonCharacter Chara
 			if ((Parse->Element->Parent != NULL) && (Parse->Element->Parent->Type == json_TypeObject))
 			{
 				Parse->Element = Parse->Element->Parent;
-				return json_ParseValueEnd;
+				if (JsonParseReport(Parse, true))
+				{
+					return json_ParseValueEnd;
+				}
 			}
 		}
 	}
@@ -255,7 +295,10 @@ static tJsonParseState JsonParseValueEnd(tJsonParse *Parse, tJsonCharacter Chara
 		if ((Parse->Element->Parent != NULL) && (Parse->Element->Parent->Type == json_TypeArray))
 		{
 			Parse->Element = Parse->Element->Parent;
-			return json_ParseValueEnd;
+			if (JsonParseReport(Parse, true))
+			{
+				return json_ParseValueEnd;
+			}
 		}
 	}
 	else if (Character == '/')
@@ -284,7 +327,7 @@ static tJsonParseState JsonParseValueLiteral(tJsonParse *Parse, tJsonCharacter C
 {
 	if (!JsonCharacterIsLiteral(Character))
 	{
-		return JsonParseValueEnd(Parse, Character);
+		return JsonParseReport(Parse, false) ? JsonParseValueEnd(Parse, Character) : json_ParseError;
 	}
 	else if (JsonStringAddCharacter(&Parse->Element->Name, Character))
 	{
@@ -295,11 +338,242 @@ static tJsonParseState JsonParseValueLiteral(tJsonParse *Parse, tJsonCharacter C
 }
 
 
+static tJsonParseState JsonParseSkipEnd(tJsonParse *Parse, tJsonCharacter Character)
+{
+	tJsonElement *Container;
+
+	Container = Parse->AllocateChild ? Parse->Element : Parse->Element->Parent;
+	if (Container == NULL)
+	{
+		return json_ParseError;
+	}
+
+	if (Character == ',')
+	{
+		if (Container->Type == json_TypeKey)
+		{
+			Parse->Element = Container;
+			return json_ParseKeyStart;
+		}
+		else if (Container->Type == json_TypeObject)
+		{
+			return json_ParseKeyStart;
+		}
+		else if (Container->Type == json_TypeArray)
+		{
+			return json_ParseValueStart;
+		}
+	}
+	else if ((Character == '}') && (Container->Type == json_TypeKey))
+	{
+		Parse->Element = Container->Parent;
+		return json_ParseValueEnd;
+	}
+	else if (((Character == '}') && (Container->Type == json_TypeObject)) || ((Character == ']') && (Container->Type == json_TypeArray)))
+	{
+		Parse->Element = Container;
+		Parse->AllocateChild = false;
+		return json_ParseValueEnd;
+	}
+	else if (Character == '/')
+	{
+		JsonParseSetCommentState(Parse, Parse->State);
+		return json_ParseCommentStart;
+	}
+	else if (Character == '\0')
+	{
+		if (Container->Type == json_TypeRoot)
+		{
+			Parse->Element = Container;
+			return json_ParseComplete;
+		}
+	}
+	else if (JsonCharacterIsWhitespace(Character))
+	{
+		return json_ParseSkipEnd;
+	}
+
+	return json_ParseError;
+}
+
+
+static bool JsonParseSkipOpen(tJsonParse *Parse, tJsonCharacter Character)
+{
+	if (Parse->SkipDepth == JSON_PARSE_SKIP_DEPTH)
+	{
+		return false;
+	}
+
+	if (Character == '{')
+	{
+		Parse->SkipObject[Parse->SkipDepth / 8] |= (uint8_t)(1 << (Parse->SkipDepth % 8));
+	}
+	else
+	{
+		Parse->SkipObject[Parse->SkipDepth / 8] &= (uint8_t)~(1 << (Parse->SkipDepth % 8));
+	}
+	Parse->SkipDepth++;
+
+	return true;
+}
+
+
+static bool JsonParseSkipClose(tJsonParse *Parse, tJsonCharacter Character)
+{
+	bool IsObject;
+
+	IsObject = (Parse->SkipObject[(Parse->SkipDepth - 1) / 8] & (1 << ((Parse->SkipDepth - 1) % 8))) != 0;
+	if (IsObject != (Character == '}'))
+	{
+		return false;
+	}
+	Parse->SkipDepth--;
+
+	return true;
+}
+
+
+static tJsonParseState JsonParseSkip(tJsonParse *Parse, tJsonCharacter Character)
+{
+	if (Parse->SkipDepth == 0)
+	{
+		return JsonCharacterIsLiteral(Character) ? json_ParseSkip : JsonParseSkipEnd(Parse, Character);
+	}
+	else if (Character == '"')
+	{
+		return json_ParseSkipString;
+	}
+	else if ((Character == '{') || (Character == '['))
+	{
+		return JsonParseSkipOpen(Parse, Character) ? json_ParseSkip : json_ParseError;
+	}
+	else if ((Character == '}') || (Character == ']'))
+	{
+		if (!JsonParseSkipClose(Parse, Character))
+		{
+			return json_ParseError;
+		}
+		return (Parse->SkipDepth == 0) ? json_ParseSkipEnd : json_ParseSkip;
+	}
+	else if (Character == '/')
+	{
+		JsonParseSetCommentState(Parse, Parse->State);
+		return json_ParseCommentStart;
+	}
+	else if (Character == '\0')
+	{
+		return json_ParseError;
+	}
+
+	return json_ParseSkip;
+}
+
+
+static tJsonParseState JsonParseSkipString(tJsonParse *Parse, tJsonCharacter Character)
+{
+	if (Character == '\\')
+	{
+		return json_ParseSkipEscape;
+	}
+	else if (Character == '"')
+	{
+		return (Parse->SkipDepth == 0) ? json_ParseSkipEnd : json_ParseSkip;
+	}
+	else if (Character == '\0')
+	{
+		return json_ParseError;
+	}
+
+	return json_ParseSkipString;
+}
+
+
+static tJsonParseState JsonParseSkipEscape(tJsonParse *Parse, tJsonCharacter Character)
+{
+	return (Character == '\0') ? json_ParseError : json_ParseSkipString;
+}
+
+
+static bool JsonParseGetValueType(tJsonCharacter Character, tJsonType *Type)
+{
+	if (Character == '{')
+	{
+		*Type = json_TypeObject;
+	}
+	else if (Character == '[')
+	{
+		*Type = json_TypeArray;
+	}
+	else if (Character == '"')
+	{
+		*Type = json_TypeValueString;
+	}
+	else if ((Character != '/') && JsonCharacterIsLiteral(Character))
+	{
+		*Type = json_TypeValueLiteral;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+static tJsonParseState JsonParseSkipValue(tJsonParse *Parse, tJsonFilterResult Result, tJsonType Type)
+{
+	tJsonElement *Parent;
+	tJsonElement *Object;
+
+	Parent = Parse->AllocateChild ? Parse->Element : Parse->Element->Parent;
+
+	if (Result == json_FilterShell)
+	{
+		if (!JsonParseAllocateElement(Parse, Type))
+		{
+			return json_ParseError;
+		}
+		Parse->AllocateChild = false;
+	}
+	else if (Parent->Type == json_TypeKey)
+	{
+		Object = Parent->Parent;
+		Parse->Element = JsonElementFreeLast(Object);
+		Parse->AllocateChild = (Parse->Element == NULL);
+		if (Parse->AllocateChild)
+		{
+			Parse->Element = Object;
+		}
+	}
+
+	Parse->SkipDepth = 0;
+	if ((Type == json_TypeObject) || (Type == json_TypeArray))
+	{
+		JsonParseSkipOpen(Parse, (Type == json_TypeObject) ? '{' : '[');
+	}
+
+	return (Type == json_TypeValueString) ? json_ParseSkipString : json_ParseSkip;
+}
+
+
 static tJsonParseState JsonParseValueStart(tJsonParse *Parse, tJsonCharacter Character)
 {
+	tJsonFilterResult Result;
+	tJsonType Type;
+
+	if ((Parse->Filter != NULL) && JsonParseGetValueType(Character, &Type))
+	{
+		Result = JsonFilterValue(Parse->Filter, Parse->AllocateChild ? Parse->Element : Parse->Element->Parent, Type);
+		if ((Result == json_FilterSkip) || (Result == json_FilterShell))
+		{
+			return JsonParseSkipValue(Parse, Result, Type);
+		}
+	}
+
 	if (Character == '{')
 	{
-		if (JsonParseAllocateElement(Parse, json_TypeObject))
+		if (JsonParseAllocateElement(Parse, json_TypeObject) && ((Parse->Filter == NULL) || JsonFilterEnter(Parse->Filter, Parse->Element)))
 		{
 			Parse->AllocateChild = true;
 			return json_ParseKeyStart;
@@ -307,7 +581,7 @@ static tJsonParseState JsonParseValueStart(tJsonParse *Parse, tJsonCharacter Cha
 	}
 	else if (Character == '[')
 	{
-		if (JsonParseAllocateElement(Parse, json_TypeArray))
+		if (JsonParseAllocateElement(Parse, json_TypeArray) && ((Parse->Filter == NULL) || JsonFilterEnter(Parse->Filter, Parse->Element)))
 		{
 			Parse->AllocateChild = true;
 			return json_ParseValueStart;
@@ -315,7 +589,7 @@ static tJsonParseState JsonParseValueStart(tJsonParse *Parse, tJsonCharacter Cha
 	}
 	else if (Character == ']')
 	{
-		if (Parse->Element->Type == json_TypeArray)
+		if ((Parse->Element->Type == json_TypeArray) && JsonParseReport(Parse, true))
 		{
 			return json_ParseValueEnd;
 		}
@@ -359,7 +633,7 @@ static tJsonParseState JsonParseCommentStart(tJsonParse *Parse, tJsonCharacter C
 {
 	if ((Character == '/') || (Character == '*'))
 	{
-		if (Parse->StripComments || JsonParseAllocateElement(Parse, json_TypeComment))
+		if (JsonParseIsStripping(Parse) || JsonParseAllocateElement(Parse, json_TypeComment))
 		{
 			return (Character == '/') ? json_ParseCommentLine : json_ParseCommentBlock;
 		}
@@ -373,13 +647,17 @@ static tJsonParseState JsonParseCommentLine(tJsonParse *Parse, tJsonCharacter Ch
 {
 	if ((Character == '\r') || (Character == '\n'))
 	{
-		if (!Parse->StripComments)
+		if (!JsonParseIsStripping(Parse))
 		{
 			Parse->AllocateChild = false;
+			if (!JsonParseReport(Parse, false))
+			{
+				return json_ParseError;
+			}
 		}
 		return JsonParseSetCommentState(Parse, json_ParseError);
 	}
-	else if (Parse->StripComments || JsonStringAddCharacter(&Parse->Element->Name, Character))
+	else if (JsonParseIsStripping(Parse) || JsonStringAddCharacter(&Parse->Element->Name, Character))
 	{
 		return json_ParseCommentLine;
 	}
@@ -396,9 +674,12 @@ static tJsonParseState JsonParseCommentBlock(tJsonParse *Parse, tJsonCharacter C
 	}
 	else if ((Character == '\r') || (Character == '\n'))
 	{
-		return json_ParseCommentBlockLine;
+		if (JsonParseIsStripping(Parse) || JsonParseReport(Parse, false))
+		{
+			return json_ParseCommentBlockLine;
+		}
 	}
-	else if (Parse->StripComments || JsonStringAddCharacter(&Parse->Element->Name, Character))
+	else if (JsonParseIsStripping(Parse) || JsonStringAddCharacter(&Parse->Element->Name, Character))
 	{
 		return json_ParseCommentBlock;
 	}
@@ -413,7 +694,7 @@ static tJsonParseState JsonParseCommentBlockLine(tJsonParse *Parse, tJsonCharact
 	{
 		return json_ParseCommentBlockLine;
 	}
-	else if (!Parse->StripComments)
+	else if (!JsonParseIsStripping(Parse))
 	{
 		Parse->AllocateChild = false;
 		if (!JsonParseAllocateElement(Parse, json_TypeComment))
@@ -430,14 +711,18 @@ static tJsonParseState JsonParseCommentBlockEnd(tJsonParse *Parse, tJsonCharacte
 {
 	if (Character == '/')
 	{
-		if (!Parse->StripComments)
+		if (!JsonParseIsStripping(Parse))
 		{
 			Parse->AllocateChild = false;
+			if (!JsonParseReport(Parse, false))
+			{
+				return json_ParseError;
+			}
 		}
 		return JsonParseSetCommentState(Parse, json_ParseError);
 	}
 	
-	if (Parse->StripComments || JsonStringAddCharacter(&Parse->Element->Name, '*'))
+	if (JsonParseIsStripping(Parse) || JsonStringAddCharacter(&Parse->Element->Name, '*'))
 	{
 		return JsonParseCommentBlock(Parse, Character);
 	}
@@ -452,10 +737,58 @@ void JsonParseSetUp(tJsonParse *Parse, bool StripComments, tJsonElement *RootEle
 	Parse->State = json_ParseValueStart;
 	Parse->Element = RootElement;
 	Parse->Utf16Length = 0;
+	Parse->Utf8Length = 0;
 	Parse->CommentState = json_ParseError;
 	Parse->EscapeState = json_ParseError;
 	Parse->AllocateChild = true;
 	Parse->StripComments = StripComments;
+	Parse->ViewContent = false;
+	Parse->Filter = NULL;
+	Parse->SkipDepth = 0;
+	Parse->Callback = NULL;
+	Parse->Context = NULL;
+	Parse->Reported = false;
+	Parse->ValidContent = NULL;
+	Parse->ValidOffset = 0;
+	Parse->Valid = false;
+}
+
+
+void JsonParseSetUpView(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement)
+{
+	JsonParseSetUp(Parse, StripComments, RootElement);
+	Parse->ViewContent = true;
+}
+
+
+void JsonParseSetUpAllocator(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, const tJsonAllocator *Allocator)
+{
+	JsonElementCleanUp(RootElement);
+	JsonElementSetUpAllocator(RootElement, Allocator);
+	JsonParseSetUp(Parse, StripComments, RootElement);
+}
+
+
+bool JsonParseSetUpFilter(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, tJsonFilter *Filter)
+{
+	JsonParseSetUp(Parse, StripComments, RootElement);
+	Parse->Filter = Filter;
+	if (!JsonFilterStart(Filter, RootElement))
+	{
+		Parse->State = json_ParseError;
+		return false;
+	}
+
+	return true;
+}
+
+
+void JsonParseSetUpCallback(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, tJsonParseCallback Callback, void *Context)
+{
+	JsonParseSetUp(Parse, StripComments, RootElement);
+	Parse->ViewContent = true;
+	Parse->Callback = Callback;
+	Parse->Context = Context;
 }
 
 
@@ -464,15 +797,27 @@ void JsonParseCleanUp(tJsonParse *Parse)
 	Parse->State = json_ParseComplete;
 	Parse->Element = NULL;
 	Parse->Utf16Length = 0;
+	Parse->Utf8Length = 0;
 	Parse->CommentState = json_ParseError;
 	Parse->EscapeState = json_ParseError;
 	Parse->AllocateChild = false;
 	Parse->StripComments = false;
+	Parse->ViewContent = false;
+	Parse->Filter = NULL;
+	Parse->SkipDepth = 0;
+	Parse->Callback = NULL;
+	Parse->Context = NULL;
+	Parse->Reported = false;
+	Parse->ValidContent = NULL;
+	Parse->ValidOffset = 0;
+	Parse->Valid = false;
 }
 
 
 int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character)
 {
+	Parse->Reported = false;
+
 	if ((Parse->State != json_ParseComplete) && (Parse->State != json_ParseError))
 	{
 		if (Parse->Element == NULL)
@@ -547,6 +892,22 @@ int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character)
 					Parse->State = JsonParseCommentBlockEnd(Parse, Character);
 				break;
 
+				case json_ParseSkip:
+					Parse->State = JsonParseSkip(Parse, Character);
+				break;
+
+				case json_ParseSkipString:
+					Parse->State = JsonParseSkipString(Parse, Character);
+				break;
+
+				case json_ParseSkipEscape:
+					Parse->State = JsonParseSkipEscape(Parse, Character);
+				break;
+
+				case json_ParseSkipEnd:
+					Parse->State = JsonParseSkipEnd(Parse, Character);
+				break;
+
 				default:
 					Parse->State = json_ParseError;
 				break;
@@ -562,6 +923,10 @@ int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character)
 	{
 		return JSON_PARSE_COMPLETE;
 	}
+	else if (Parse->Reported)
+	{
+		return JSON_PARSE_REPORTED;
+	}
 	else
 	{
 		return JSON_PARSE_INCOMPLETE;
@@ -569,12 +934,324 @@ int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character)
 }
 
 
+static bool JsonParseIsSpanState(tJsonParseState State)
+{
+	return (State == json_ParseKey) || (State == json_ParseValueString) || (State == json_ParseValueLiteral) || (State == json_ParseCommentLine) || (State == json_ParseCommentBlock);
+}
+
+
+static bool JsonParseIsSpanDelimiter(tJsonParseState State, uint8_t Byte)
+{
+	switch (State)
+	{
+		case json_ParseKey:
+		case json_ParseValueString:
+			return (Byte == '"') || (Byte == '\\') || (Byte == '\0');
+
+		case json_ParseValueLiteral:
+			return !JsonCharacterIsLiteral(Byte);
+
+		case json_ParseCommentLine:
+			return (Byte == '\r') || (Byte == '\n') || (Byte == '\0');
+
+		case json_ParseCommentBlock:
+			return (Byte == '*') || (Byte == '\r') || (Byte == '\n') || (Byte == '\0');
+
+		default:
+			return true;
+	}
+}
+
+
+static size_t JsonParseUtf8Span(tJsonParse *Parse, const uint8_t *Content, size_t Size, size_t Offset, bool Valid)
+{
+	tJsonCharacter Character;
+	size_t DecodeLength;
+	size_t Length;
+
+	if ((Parse->Element == NULL) || !JsonParseIsSpanState(Parse->State))
+	{
+		return 0;
+	}
+
+	for (Length = Offset; Length < Size; Length = Length + DecodeLength)
+	{
+		if ((Parse->State == json_ParseKey) || (Parse->State == json_ParseValueString))
+		{
+			Length = Length + JsonScanString(&Content[Length], Size - Length);
+		}
+		else if ((Parse->State == json_ParseCommentLine) || (Parse->State == json_ParseCommentBlock))
+		{
+			Length = Length + JsonScanComment(&Content[Length], Size - Length);
+		}
+
+		if (Length == Size)
+		{
+			break;
+		}
+		else if (Content[Length] < 0x80)
+		{
+			if (JsonParseIsSpanDelimiter(Parse->State, Content[Length]))
+			{
+				break;
+			}
+			DecodeLength = 1;
+		}
+		else if (Parse->State == json_ParseValueLiteral)
+		{
+			break;
+		}
+		else if (Valid)
+		{
+			DecodeLength = JsonUtf8DecodeNextTrusted(Content, Length, &Character);
+		}
+		else if ((DecodeLength = JsonUtf8DecodeNext(Content, Size, Length, &Character)) == 0)
+		{
+			break;
+		}
+	}
+	Length = Length - Offset;
+
+	if ((Length != 0) && ((Parse->State == json_ParseKey) || (Parse->State == json_ParseValueString) || (Parse->State == json_ParseValueLiteral) || !JsonParseIsStripping(Parse)))
+	{
+		if (Parse->ViewContent ? !JsonStringAddView(&Parse->Element->Name, &Content[Offset], Length) : !JsonStringAddBytes(&Parse->Element->Name, &Content[Offset], Length))
+		{
+			Parse->State = json_ParseError;
+		}
+	}
+
+	return Length;
+}
+
+
+static bool JsonParseIsSkipState(const tJsonParse *Parse)
+{
+	return (Parse->State == json_ParseSkipString) || ((Parse->State == json_ParseSkip) && (Parse->SkipDepth != 0));
+}
+
+
+static size_t JsonParseUtf8Skip(tJsonParse *Parse, const uint8_t *Content, size_t Size, size_t Offset)
+{
+	size_t Length;
+
+	for (Length = Offset; (Length < Size) && JsonParseIsSkipState(Parse); Length++)
+	{
+		if (Parse->State == json_ParseSkipString)
+		{
+			Length = Length + JsonScanString(&Content[Length], Size - Length);
+			if ((Length == Size) || (Content[Length] == '\0'))
+			{
+				break;
+			}
+			else if (Content[Length] == '"')
+			{
+				Parse->State = (Parse->SkipDepth != 0) ? json_ParseSkip : json_ParseSkipEnd;
+			}
+			else if (Content[Length] == '\\')
+			{
+				if ((Length + 1 == Size) || (Content[Length + 1] == '\0'))
+				{
+					break;
+				}
+				Length++;
+			}
+		}
+		else if (Content[Length] == '"')
+		{
+			Parse->State = json_ParseSkipString;
+		}
+		else if ((Content[Length] == '{') || (Content[Length] == '['))
+		{
+			if (!JsonParseSkipOpen(Parse, Content[Length]))
+			{
+				break;
+			}
+		}
+		else if ((Content[Length] == '}') || (Content[Length] == ']'))
+		{
+			if (!JsonParseSkipClose(Parse, Content[Length]))
+			{
+				break;
+			}
+			if (Parse->SkipDepth == 0)
+			{
+				Parse->State = json_ParseSkipEnd;
+			}
+		}
+		else if ((Content[Length] == '/') || (Content[Length] == '\0'))
+		{
+			break;
+		}
+	}
+
+	return Length - Offset;
+}
+
+
+static bool JsonParseIsWhitespaceState(tJsonParseState State)
+{
+	return (State == json_ParseKeyStart) || (State == json_ParseKeyEnd) || (State == json_ParseValueStart) || (State == json_ParseValueEnd) || (State == json_ParseCommentBlockLine) || (State == json_ParseSkipEnd);
+}
+
+
+static int JsonParseUtf8Partial(tJsonParse *Parse, const uint8_t *Content, size_t Size, size_t *Offset)
+{
+	tJsonCharacter Character;
+	size_t Length;
+
+	Length = (Parse->Utf8[0] >= 0xF0) ? 4 : (Parse->Utf8[0] >= 0xE0) ? 3 : 2;
+
+	for (; (*Offset < Size) && (Parse->Utf8Length < Length); *Offset = *Offset + 1)
+	{
+		if ((Content[*Offset] & 0xC0) != 0x80)
+		{
+			Parse->Utf8Length = 0;
+			Parse->State = json_ParseError;
+			return JSON_PARSE_ERROR;
+		}
+		Parse->Utf8[Parse->Utf8Length] = Content[*Offset];
+		Parse->Utf8Length++;
+	}
+
+	if (Parse->Utf8Length < Length)
+	{
+		return JSON_PARSE_INCOMPLETE;
+	}
+
+	Parse->Utf8Length = 0;
+	if (JsonUtf8DecodeNext(Parse->Utf8, Length, 0, &Character) != Length)
+	{
+		Parse->State = json_ParseError;
+		return JSON_PARSE_ERROR;
+	}
+
+	return JsonParseCharacter(Parse, Character);
+}
+
+
+int JsonParseUtf8(tJsonParse *Parse, const uint8_t *Content, size_t Size, size_t *Offset)
+{
+	tJsonCharacter Character;
+	tJsonParseState PreviousState;
+	size_t DiscardOffset = 0;
+	size_t ValidOffset;
+	size_t Length;
+	int State = JSON_PARSE_INCOMPLETE;
+	bool Valid = false;
+	JSON_STATS_TIMER(Timer);
+
+	if (Offset == NULL)
+	{
+		Offset = &DiscardOffset;
+	}
+
+	ValidOffset = *Offset;
+	if (Parse->Reported && (Parse->ValidContent == Content) && (Parse->ValidOffset > *Offset) && (Parse->ValidOffset <= Size))
+	{
+		ValidOffset = Parse->ValidOffset;
+		Valid = Parse->Valid;
+	}
+
+	if (Parse->Utf8Length != 0)
+	{
+		State = JsonParseUtf8Partial(Parse, Content, Size, Offset);
+		ValidOffset = *Offset;
+	}
+
+	while ((State == JSON_PARSE_INCOMPLETE) && (*Offset < Size))
+	{
+		if (*Offset >= ValidOffset)
+		{
+			Length = JsonUtf8GetCompleteLength(&Content[*Offset], (Size - *Offset < JSON_PARSE_VALIDATE_SIZE) ? Size - *Offset : JSON_PARSE_VALIDATE_SIZE);
+			Valid = JsonUtf8Validate(&Content[*Offset], Length);
+			ValidOffset = *Offset + Length;
+		}
+
+		if (JsonParseIsSpanState(Parse->State))
+		{
+			Length = JsonParseUtf8Span(Parse, Content, ValidOffset, *Offset, Valid);
+			if (Length != 0)
+			{
+				*Offset = *Offset + Length;
+				State = (Parse->State == json_ParseError) ? JSON_PARSE_ERROR : JSON_PARSE_INCOMPLETE;
+				continue;
+			}
+		}
+		else if (JsonParseIsSkipState(Parse))
+		{
+			Length = JsonParseUtf8Skip(Parse, Content, Size, *Offset);
+			if (Length != 0)
+			{
+				*Offset = *Offset + Length;
+				continue;
+			}
+		}
+		else if ((Parse->Element != NULL) && JsonParseIsWhitespaceState(Parse->State))
+		{
+			Length = *Offset + JsonScanWhitespace(&Content[*Offset], Size - *Offset);
+			if (Length != *Offset)
+			{
+				*Offset = Length;
+				continue;
+			}
+		}
+
+		if (Content[*Offset] < 0x80)
+		{
+			Character = Content[*Offset];
+			Length = 1;
+		}
+		else if (Valid && (*Offset < ValidOffset))
+		{
+			Length = JsonUtf8DecodeNextTrusted(Content, *Offset, &Character);
+		}
+		else
+		{
+			Length = JsonUtf8DecodeNext(Content, Size, *Offset, &Character);
+			if ((Length == 0) && (JsonUtf8GetCompleteLength(&Content[*Offset], Size - *Offset) == 0))
+			{
+				memcpy(Parse->Utf8, &Content[*Offset], Size - *Offset);
+				Parse->Utf8Length = Size - *Offset;
+				*Offset = Size;
+			}
+			if (Length == 0)
+			{
+				break;
+			}
+		}
+
+		PreviousState = Parse->State;
+		State = JsonParseCharacter(Parse, Character);
+		if (Parse->ViewContent && (PreviousState == json_ParseValueStart) && (Parse->State == json_ParseValueLiteral))
+		{
+			JsonStringClear(&Parse->Element->Name);
+			JsonStringAddView(&Parse->Element->Name, &Content[*Offset], Length);
+		}
+		*Offset = *Offset + Length;
+	}
+
+	Parse->ValidContent = (*Offset < Size) ? Content : NULL;
+	Parse->ValidOffset = ValidOffset;
+	Parse->Valid = Valid;
+
+	JSON_STATS_TIME(json_StatsParse, Timer);
+
+	return State;
+}
+
+
 int JsonParse(tJsonParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Size, size_t *Offset)
 {
 	tJsonCharacter Character;
 	size_t DiscardOffset = 0;
 	size_t DecodeLength;
 	int State = JSON_PARSE_INCOMPLETE;
+	JSON_STATS_TIMER(Timer);
+
+	if (UtfType == json_Utf8)
+	{
+		return JsonParseUtf8(Parse, Content, Size, Offset);
+	}
 
 	if (Offset == NULL)
 	{
@@ -592,5 +1269,62 @@ int JsonParse(tJsonParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, s
 		State = JsonParseCharacter(Parse, Character);
 	}
 
+	JSON_STATS_TIME(json_StatsParse, Timer);
+
 	return State;
 }
+
+
+static bool JsonParseIsNameState(const tJsonParse *Parse)
+{
+	switch (Parse->State)
+	{
+		case json_ParseEscape:
+		case json_ParseUtf16Escape:
+		case json_ParseUtf16:
+		case json_ParseUtf16Digit:
+		case json_ParseKey:
+		case json_ParseValueString:
+		case json_ParseValueLiteral:
+			return true;
+
+		case json_ParseCommentLine:
+		case json_ParseCommentBlock:
+		case json_ParseCommentBlockEnd:
+			return !JsonParseIsStripping(Parse);
+
+		default:
+			return false;
+	}
+}
+
+
+bool JsonParseIsNameComplete(const tJsonParse *Parse, const tJsonElement *Element)
+{
+	return (Element != Parse->Element) || !JsonParseIsNameState(Parse);
+}
+
+
+bool JsonParseIsComplete(const tJsonParse *Parse, const tJsonElement *Element)
+{
+	const tJsonElement *Parsed;
+
+	if (Parse->State == json_ParseComplete)
+	{
+		return true;
+	}
+	else if (Element == Parse->Element)
+	{
+		return !Parse->AllocateChild && !JsonParseIsNameState(Parse);
+	}
+
+	for (Parsed = Parse->Element; Parsed != NULL; Parsed = Parsed->Parent)
+	{
+		if (Parsed == Element)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -2,10 +2,24 @@
 #define JSON_PARSE_H
 
 #include "json_element.h"
+#include "json_filter.h"
 #include "json_utf16.h"
+#include "json_utf8.h"
 #include "json_utf.h"
 
 
+/**
+ * @brief The number of bytes of UTF-8 encoded content that are validated at a time (just ahead of the parsing)
+ */
+#define JSON_PARSE_VALIDATE_SIZE 65536
+
+
+/**
+ * @brief The maximum number of objects and arrays that can be open in a value that is skipped by a filter (see \a `JsonParseSetUpFilter()`)
+ */
+#define JSON_PARSE_SKIP_DEPTH 1024
+
+
 /**
  * @brief Enumeration used to define different parsing states
  */
@@ -29,22 +43,55 @@ typedef enum
 	json_ParseCommentBlock,     /**< Parsing a character in a block comment */
 	json_ParseCommentBlockLine, /**< Parsing a new line in a block comment */
 	json_ParseCommentBlockEnd,  /**< Parsing the end of a block comment */
+	json_ParseSkip,             /**< Skipping a character in a value that is not required by the filter */
+	json_ParseSkipString,       /**< Skipping a character in a string in a value that is not required by the filter */
+	json_ParseSkipEscape,       /**< Skipping an escaped character in a string in a value that is not required by the filter */
+	json_ParseSkipEnd,          /**< Parsing the end of a value that was skipped */
 } tJsonParseState;
 
 
+/**
+ * @brief Type that holds a bit for each object or array that is open in a value that is skipped by a filter (set for an object)
+ */
+typedef uint8_t tJsonSkipStack[JSON_PARSE_SKIP_DEPTH / 8];
+
+
+/**
+ * @brief Type used for a function that is called as a parser parses each element
+ * @param Context The context passed to \a `JsonParseSetUpCallback()`
+ * @param Element The element - an object or array that has been started (or ended), or a key, value or comment whose name is complete
+ * @param End     Indicates whether an object or array has been ended (rather than started)
+ * @return A true value should be returned to continue parsing.
+ * @return A false value should be returned to stop parsing (with an error).
+ */
+typedef bool (* tJsonParseCallback)(void *Context, const tJsonElement *Element, bool End);
+
+
 /**
  * @brief Type used for parsing JSON content
  */
 typedef struct
 {
-	tJsonParseState State;         /**< The current parse state */
-	tJsonElement   *Element;       /**< The current element being parsed */
-	tJsonParseState CommentState;  /**< The state that the parser is in when a comment is encountered (so that it can be restored afterwards) */
-	tJsonParseState EscapeState;   /**< The state that the parser is in when a character needs to be escaped (so that it can be restored afterwards) */
-	tJsonUtf16      Utf16;         /**< The UTF-16 encoding of a character being escaped */
-	size_t          Utf16Length;   /**< The length of the UTF-16 encoding */
-	bool            AllocateChild; /**< Indicates whether an allocated element should be a child element (or the next sibling element) */
-	bool            StripComments; /**< Indicates whether to strip or keep any comments that are in the content */
+	tJsonParseState    State;         /**< The current parse state */
+	tJsonElement      *Element;       /**< The current element being parsed */
+	tJsonParseState    CommentState;  /**< The state that the parser is in when a comment is encountered (so that it can be restored afterwards) */
+	tJsonParseState    EscapeState;   /**< The state that the parser is in when a character needs to be escaped (so that it can be restored afterwards) */
+	tJsonUtf16         Utf16;         /**< The UTF-16 encoding of a character being escaped */
+	size_t             Utf16Length;   /**< The length of the UTF-16 encoding */
+	tJsonUtf8          Utf8;          /**< The start of a UTF-8 encoded character that was cut short by the end of the content */
+	size_t             Utf8Length;    /**< The length of the start of the UTF-8 encoded character */
+	bool               AllocateChild; /**< Indicates whether an allocated element should be a child element (or the next sibling element) */
+	bool               StripComments; /**< Indicates whether to strip or keep any comments that are in the content */
+	bool               ViewContent;   /**< Indicates whether element names should be views of the parsed content (rather than copies of it) */
+	tJsonFilter       *Filter;        /**< The filter that selects the elements to allocate (or \a `NULL` to allocate all of the elements) */
+	size_t             SkipDepth;     /**< The number of objects and arrays that are open in a value that is being skipped */
+	tJsonSkipStack     SkipObject;    /**< Indicates which of the objects and arrays that are open in a value that is being skipped are objects */
+	tJsonParseCallback Callback;      /**< The function that is called as each element is parsed (or \a `NULL` to keep all of the parsed elements) */
+	void              *Context;       /**< The context to pass to the callback function */
+	bool               Reported;      /**< Indicates whether the callback function was called for the last character that was parsed */
+	const uint8_t     *ValidContent;  /**< The UTF-8 encoded content that was last validated if parsing stopped before its end (so that it is not validated again when parsing continues after \a `JSON_PARSE_REPORTED`) */
+	size_t             ValidOffset;   /**< The offset of the end of the content that was last validated */
+	bool               Valid;         /**< Indicates whether the content that was last validated is valid */
 } tJsonParse;
 
 
@@ -55,6 +102,7 @@ typedef struct
 #define JSON_PARSE_ERROR      -1 /**< A parsing error occured */
 #define JSON_PARSE_COMPLETE   0  /**< Parsing is complete */
 #define JSON_PARSE_INCOMPLETE 1  /**< Parsing is incomplete */
+#define JSON_PARSE_REPORTED   2  /**< Parsing is incomplete, but the callback function has been called (see \a `JsonParseSetUpCallback()`) */
 /** @} */
 
 
@@ -68,6 +116,64 @@ typedef struct
 void JsonParseSetUp(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement);
 
 
+/**
+ * @brief Sets up a JSON content parser that makes element names views of the parsed content
+ * @param Parse         The JSON content parser to set up
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param RootElement   Used to return the elements parsed from the JSON content
+ * @return None
+ * @note Any name that is parsed from UTF-8 content without any escaped characters is not copied - the element name is a view of the content instead (see \a `JsonStringAddView()`).
+ * @note Names that contain escaped characters (or that are parsed from UTF-16 content) are still copied.
+ * @note All of the content passed to \a `JsonParse()` must remain unchanged (and must not be freed) until the parsed elements are cleared.
+ */
+void JsonParseSetUpView(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement);
+
+
+/**
+ * @brief Sets up a JSON content parser that allocates the parsed elements (and their names) from an allocator
+ * @param Parse         The JSON content parser to set up
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param RootElement   Used to return the elements parsed from the JSON content (cleaned up and set up again as a root element that uses the allocator)
+ * @param Allocator     The allocator (or \a `NULL` for the default allocator)
+ * @return None
+ * @note The allocator must remain valid until the root element is cleaned up (see \a `JsonElementSetUpAllocator()`).
+ */
+void JsonParseSetUpAllocator(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, const tJsonAllocator *Allocator);
+
+
+/**
+ * @brief Sets up a JSON content parser that only allocates the elements that are selected by a filter
+ * @param Parse         The JSON content parser to set up
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param RootElement   Used to return the elements parsed from the JSON content
+ * @param Filter        The filter (see \a `JsonFilterSetUp()`)
+ * @return A true value is returned if the parser was set up.
+ * @return A false value is returned if there was not enough memory to start the filter.
+ * @note The values that are not selected by the filter are skipped by tracking the nesting of their objects, arrays and strings - no elements or names are allocated for them (and their content is not fully validated).
+ * @note The brackets of a skipped value must still match, and no more than \a `JSON_PARSE_SKIP_DEPTH` objects and arrays can be open in it.
+ * @note Any comments next to a skipped value are also skipped.
+ * @note The filter must remain valid until parsing is complete.
+ */
+bool JsonParseSetUpFilter(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, tJsonFilter *Filter);
+
+
+/**
+ * @brief Sets up a JSON content parser that passes each element to a callback function (rather than keeping all of the parsed elements)
+ * @param Parse         The JSON content parser to set up
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param RootElement   Used to hold the elements that are being parsed
+ * @param Callback      The function to call as each element is parsed
+ * @param Context       The context to pass to the callback function
+ * @return None
+ * @note The callback function is called when an object or array is started and ended, and when the name of a key, value or comment is complete.
+ * @note Each element is freed once its next sibling has been allocated - only the elements on the path to the element being parsed are held.
+ * @note Element names are views of the parsed content where possible (see \a `JsonParseSetUpView()`).
+ * @note Parsing stops after any character that calls the callback function (and \a `JSON_PARSE_REPORTED` is returned) so that the element can be used before it is freed.
+ * @note Parsing should then be continued with the same content (from the returned offset).
+ */
+void JsonParseSetUpCallback(tJsonParse *Parse, bool StripComments, tJsonElement *RootElement, tJsonParseCallback Callback, void *Context);
+
+
 /**
  * @brief Cleans up a JSON content parser
  * @param Parse The JSON content parser to clean up
@@ -83,12 +189,31 @@ void JsonParseCleanUp(tJsonParse *Parse);
  * @return `JSON_PARSE_ERROR`      is returned if there was a parsing error.
  * @return `JSON_PARSE_COMPLETE`   is returned if the parsing is complete.
  * @return `JSON_PARSE_INCOMPLETE` is returned if parsing is not yet complete.
+ * @return `JSON_PARSE_REPORTED`   is returned if parsing is not yet complete and the callback function has been called.
  * @note The parsing should be completed by passing a null (zero value) character
  * @note The character should be a unicode code point value.
  */
 int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character);
 
 
+/**
+ * @brief Parses UTF-8 encoded JSON content
+ * @param Parse   The JSON content parser
+ * @param Content The UTF-8 encoded JSON content
+ * @param Length  The length of the JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is parsed
+ * @return `JSON_PARSE_ERROR`      is returned if there was a parsing error.
+ * @return `JSON_PARSE_COMPLETE`   is returned if the parsing is complete.
+ * @return `JSON_PARSE_INCOMPLETE` is returned if parsing is not yet complete.
+ * @return `JSON_PARSE_REPORTED`   is returned if parsing is not yet complete and the callback function has been called.
+ * @note The parsing should be completed by parsing a null character.
+ * @note This gives the same result as \a `JsonParse()` with a \a `json_Utf8` encoding (which uses this function) - ASCII characters are parsed without being decoded, runs of whitespace are skipped and runs of unescaped characters are added to the element names in one go.
+ * @note The content is checked with \a `JsonUtf8Validate()` up to \a `JSON_PARSE_VALIDATE_SIZE` bytes at a time as it is parsed - the characters in each valid block are decoded without checking the encoding again.
+ * @note A character that is cut short by the end of the content is kept by the parser (and \a `Offset` is moved past it) so that it can be completed by the next content.
+ */
+int JsonParseUtf8(tJsonParse *Parse, const uint8_t *Content, size_t Length, size_t *Offset);
+
+
 /**
  * @brief Parses JSON content using a UTF encoding
  * @param Parse   The JSON content parser
@@ -99,9 +224,30 @@ int JsonParseCharacter(tJsonParse *Parse, tJsonCharacter Character);
  * @return `JSON_PARSE_ERROR`      is returned if there was a parsing error.
  * @return `JSON_PARSE_COMPLETE`   is returned if the parsing is complete.
  * @return `JSON_PARSE_INCOMPLETE` is returned if parsing is not yet complete.
+ * @return `JSON_PARSE_REPORTED`   is returned if parsing is not yet complete and the callback function has been called.
  * @note The parsing should be completed by parsing an encoded null character.
  */
 int JsonParse(tJsonParse *Parse, tJsonUtfType UtfType, const uint8_t *Content, size_t Length, size_t *Offset);
 
 
+/**
+ * @brief Checks whether a parser has finished setting the name of an element
+ * @param Parse   The parser
+ * @param Element The element
+ * @return A true value is returned if the name of the element will not be changed by the parser any more.
+ * @return A false value is returned if the parser is still adding characters to the name of the element.
+ */
+bool JsonParseIsNameComplete(const tJsonParse *Parse, const tJsonElement *Element);
+
+
+/**
+ * @brief Checks whether a parser has finished parsing an element
+ * @param Parse   The parser
+ * @param Element The element
+ * @return A true value is returned if the element (its name and all of its children) will not be changed by the parser any more.
+ * @return A false value is returned if the parser is still parsing the element.
+ */
+bool JsonParseIsComplete(const tJsonParse *Parse, const tJsonElement *Element);
+
+
 #endif
@@ -1,7 +1,10 @@
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include "json_utf16.h"
 #include "json_character.h"
 #include "json_path.h"
+#include "json_stats.h"
 
 
 tJsonPath JsonPathUtf8(const uint8_t *PathString)
@@ -390,6 +393,11 @@ bool JsonPathGetString(tJsonPath Path, tJsonString *String)
 
 	JsonStringClear(String);
 
+	if (!JsonStringReserve(String, Path.Length))
+	{
+		return false;
+	}
+
 	for (PathOffset = 0; (PathOffset < Path.Length); PathOffset = PathOffset + DecodeLength)
 	{
 		DecodeLength = JsonPathGetNextCharacter(Path, PathOffset, &IsEscaped, &Character);
@@ -413,12 +421,28 @@ bool JsonPathGetString(tJsonPath Path, tJsonString *String)
 }
 
 
+static bool JsonPathIsUnescaped(tJsonPath Path)
+{
+	size_t n;
+
+	for (n = 0; n < Path.Length; n++)
+	{
+		if ((Path.Value[n] == '\\') || (Path.Value[n] == '/') || (Path.Value[n] == ':') || (Path.Value[n] == '[') || (Path.Value[n] == ']'))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
 bool JsonPathCompareString(tJsonPath Path, tJsonString *String)
 {
 	tJsonCharacter PathCharacter;
-	tJsonCharacter StringCharacter;
+	tJsonUtf8 Utf8;
 	size_t PathDecodeLength;
-	size_t StringDecodeLength;
+	size_t EncodeLength;
 	size_t StringOffset;
 	size_t StringLength;
 	size_t PathOffset;
@@ -426,7 +450,12 @@ bool JsonPathCompareString(tJsonPath Path, tJsonString *String)
 
 	StringLength = JsonStringGetLength(String);
 
-	for (StringOffset = 0, PathOffset = 0; (StringOffset < StringLength) && (PathOffset < Path.Length); StringOffset = StringOffset + StringDecodeLength, PathOffset = PathOffset + PathDecodeLength)
+	if (JsonPathIsUnescaped(Path))
+	{
+		return (Path.Length == StringLength) && ((StringLength == 0) || (memcmp(Path.Value, String->Content, StringLength) == 0));
+	}
+
+	for (StringOffset = 0, PathOffset = 0; (StringOffset < StringLength) && (PathOffset < Path.Length); StringOffset = StringOffset + EncodeLength, PathOffset = PathOffset + PathDecodeLength)
 	{
 		PathDecodeLength = JsonPathGetNextCharacter(Path, PathOffset, &IsEscaped, &PathCharacter);
 		if (PathDecodeLength == 0)
@@ -439,8 +468,8 @@ bool JsonPathCompareString(tJsonPath Path, tJsonString *String)
 			return false;
 		}
 
-		StringDecodeLength = JsonStringGetNextCharacter(String, StringOffset, &StringCharacter);
-		if ((StringDecodeLength == 0) || (PathCharacter != StringCharacter))
+		EncodeLength = JsonUtf8Encode(Utf8, sizeof(Utf8), 0, PathCharacter);
+		if ((EncodeLength == 0) || (EncodeLength > StringLength - StringOffset) || (memcmp(Utf8, &String->Content[StringOffset], EncodeLength) != 0))
 		{
 			return false;
 		}
@@ -450,6 +479,43 @@ bool JsonPathCompareString(tJsonPath Path, tJsonString *String)
 }
 
 
+bool JsonPathGetHash(tJsonPath Path, uint32_t *Hash)
+{
+	tJsonCharacter Character;
+	tJsonUtf8 Utf8;
+	size_t DecodeLength;
+	size_t EncodeLength;
+	size_t PathOffset;
+	bool IsEscaped;
+
+	*Hash = JSON_STRING_HASH_INITIAL;
+
+	for (PathOffset = 0; PathOffset < Path.Length; PathOffset = PathOffset + DecodeLength)
+	{
+		DecodeLength = JsonPathGetNextCharacter(Path, PathOffset, &IsEscaped, &Character);
+		if (DecodeLength == 0)
+		{
+			return false;
+		}
+
+		if (!IsEscaped && ((Character == '/') || (Character == ':') || (Character == '[') || (Character == ']')))
+		{
+			return false;
+		}
+
+		EncodeLength = JsonUtf8Encode(Utf8, sizeof(Utf8), 0, Character);
+		if (EncodeLength == 0)
+		{
+			return false;
+		}
+
+		*Hash = JsonStringHashBytes(*Hash, Utf8, EncodeLength);
+	}
+
+	return true;
+}
+
+
 static size_t JsonPathSkipSpaceLeft(tJsonPath Path)
 {
 	tJsonCharacter Character;
@@ -660,3 +726,156 @@ size_t JsonPathGetComponent(tJsonPath Path, tJsonType *ComponentType, tJsonPath
 
 	return Start + Length;
 }
+
+
+bool JsonPathGetPosition(tJsonPath Component, ptrdiff_t *Position)
+{
+	size_t Value = 0;
+	size_t Limit;
+	size_t Offset = 1;
+	bool IsNegative;
+
+	if ((Component.Length < 2) || (Component.Value[0] != '#'))
+	{
+		return false;
+	}
+
+	IsNegative = (Component.Value[1] == '-');
+	if (IsNegative)
+	{
+		Offset++;
+	}
+
+	if (Offset == Component.Length)
+	{
+		return false;
+	}
+
+	Limit = IsNegative ? (size_t)PTRDIFF_MAX + 1 : (size_t)PTRDIFF_MAX;
+
+	for (; Offset < Component.Length; Offset++)
+	{
+		if ((Component.Value[Offset] < '0') || (Component.Value[Offset] > '9') || (Value > (Limit - (Component.Value[Offset] - '0')) / 10))
+		{
+			return false;
+		}
+		Value = Value * 10 + (Component.Value[Offset] - '0');
+	}
+
+	if (IsNegative && (Value == 0))
+	{
+		return false;
+	}
+
+	*Position = IsNegative ? -(ptrdiff_t)(Value - 1) - 1 : (ptrdiff_t)Value;
+
+	return true;
+}
+
+
+static bool JsonPathAddCompiledComponent(tJsonCompiledPath *CompiledPath, tJsonType Type, tJsonPath Name)
+{
+	tJsonCompiledPathComponent *Component;
+	tJsonString String;
+	uint8_t *Names;
+	bool ok;
+
+	Component = (tJsonCompiledPathComponent *)JSON_STATS_REALLOC(json_StatsPath, CompiledPath->Component, (CompiledPath->Count + 1) * sizeof(tJsonCompiledPathComponent));
+	if (Component == NULL)
+	{
+		return false;
+	}
+	CompiledPath->Component = Component;
+	Component = &Component[CompiledPath->Count];
+
+	JsonStringSetUp(&String);
+
+	ok = ((Type == json_TypeObject) || (Type == json_TypeArray) || JsonPathGetString(Name, &String));
+	if (ok && (String.Length != 0))
+	{
+		Names = (uint8_t *)JSON_STATS_REALLOC(json_StatsPath, CompiledPath->Names, CompiledPath->NamesLength + String.Length);
+		ok = (Names != NULL);
+		if (ok)
+		{
+			memcpy(&Names[CompiledPath->NamesLength], String.Content, String.Length);
+			CompiledPath->Names = Names;
+		}
+	}
+
+	if (ok)
+	{
+		Component->Type = Type;
+		Component->Offset = CompiledPath->NamesLength;
+		Component->Length = String.Length;
+		Component->Hash = JsonStringGetHash(&String);
+		Component->Count = 0;
+		Component->IsPosition = (Type == json_TypeArray) && JsonPathGetPosition(Name, &Component->Position);
+		CompiledPath->NamesLength = CompiledPath->NamesLength + String.Length;
+		CompiledPath->Count++;
+	}
+
+	JsonStringCleanUp(&String);
+
+	return ok;
+}
+
+
+static bool JsonPathCompileSubPath(tJsonPath Path, tJsonCompiledPath *CompiledPath)
+{
+	tJsonPath Component;
+	tJsonType ComponentType;
+	size_t Length;
+	size_t Index;
+
+	do
+	{
+		Length = JsonPathGetComponent(Path, &ComponentType, &Component);
+		if ((Length == 0) || !JsonPathAddCompiledComponent(CompiledPath, ComponentType, Component))
+		{
+			return false;
+		}
+
+		if ((ComponentType == json_TypeArray) && !CompiledPath->Component[CompiledPath->Count - 1].IsPosition)
+		{
+			Index = CompiledPath->Count - 1;
+			if ((Component.Length != 0) && !JsonPathCompileSubPath(Component, CompiledPath))
+			{
+				return false;
+			}
+			CompiledPath->Component[Index].Count = CompiledPath->Count - Index - 1;
+		}
+
+		Path = JsonPathRight(Path, Length);
+	}
+	while (Path.Length != 0);
+
+	return true;
+}
+
+
+bool JsonPathCompile(tJsonPath Path, tJsonCompiledPath *CompiledPath)
+{
+	CompiledPath->Component = NULL;
+	CompiledPath->Count = 0;
+	CompiledPath->Names = NULL;
+	CompiledPath->NamesLength = 0;
+
+	if (!JsonPathCompileSubPath(Path, CompiledPath))
+	{
+		JsonPathCleanUpCompiled(CompiledPath);
+		return false;
+	}
+
+	return true;
+}
+
+
+void JsonPathCleanUpCompiled(tJsonCompiledPath *CompiledPath)
+{
+	JSON_STATS_FREE(json_StatsPath, CompiledPath->Component);
+	JSON_STATS_FREE(json_StatsPath, CompiledPath->Names);
+	CompiledPath->Component = NULL;
+	CompiledPath->Count = 0;
+	CompiledPath->Names = NULL;
+	CompiledPath->NamesLength = 0;
+}
@@ -15,6 +15,33 @@ typedef struct
 } tJsonPath;
 
 
+/**
+ * @brief Type used for a component of a compiled JSON path
+ */
+typedef struct
+{
+	tJsonType Type;       /**< The component type */
+	size_t    Offset;     /**< The offset to the (unescaped) component name in the compiled path names */
+	size_t    Length;     /**< The length of the component name (in bytes) */
+	uint32_t  Hash;       /**< The hash value of the component name (see \a `JsonStringGetHash()`) */
+	size_t    Count;      /**< The number of components that follow in the sub-path of an array component (zero for other component types) */
+	bool      IsPosition; /**< Indicates if an array component selects its child by position (see \a `JsonPathGetPosition()`) */
+	ptrdiff_t Position;   /**< The position of the child selected by an array component (negative positions count back from the last child) */
+} tJsonCompiledPathComponent;
+
+
+/**
+ * @brief Type used for a compiled JSON path (a JSON path that has been split into its components with unescaped names)
+ */
+typedef struct
+{
+	tJsonCompiledPathComponent *Component;      /**< The path components */
+	size_t                      Count;          /**< The number of path components */
+	uint8_t                    *Names;          /**< The UTF-8 encoded names of all the path components */
+	size_t                      NamesLength;    /**< The length of the names (in bytes) */
+} tJsonCompiledPath;
+
+
 /**
  * @brief Returns a JSON path using a UTF-8 encoded path name string
  * @param PathString The path name string (null terminated)
@@ -112,6 +139,17 @@ bool JsonPathGetString(tJsonPath Path, tJsonString *String);
 bool JsonPathCompareString(tJsonPath Path, tJsonString *String);
 
 
+/**
+ * @brief Gets the hash value of a JSON path
+ * @param Path The JSON path
+ * @param Hash Used to return the hash value
+ * @return A true value if the hash value is returned.
+ * @return A false value if the path could not be decoded (or contains an unescaped separator).
+ * @note The hash value is the same as \a `JsonStringGetHash()` for a string that compares equal to the path (see \a `JsonPathCompareString()`).
+ */
+bool JsonPathGetHash(tJsonPath Path, uint32_t *Hash);
+
+
 /**
  * @brief Gets a component of a JSON path
  * @param Path          The JSON path
@@ -123,4 +161,34 @@ bool JsonPathCompareString(tJsonPath Path, tJsonString *String);
 size_t JsonPathGetComponent(tJsonPath Path, tJsonType *ComponentType, tJsonPath *Component);
 
 
+/**
+ * @brief Gets the position selected by an array component of a JSON path
+ * @param Component The array component name (see \a `JsonPathGetComponent()`)
+ * @param Position  Used to return the position of the selected array child (zero for the first child, -1 for the last child)
+ * @return A true value if the component is a position selector (\a `#` followed by a decimal integer - for example \a `[#3]` or \a `[#-1]`).
+ * @return A false value if the component is not a position selector (it is a sub-path that is matched against each array child instead).
+ */
+bool JsonPathGetPosition(tJsonPath Component, ptrdiff_t *Position);
+
+
+/**
+ * @brief Compiles a JSON path (for repeated use with \a `JsonElementFindCompiled()`)
+ * @param Path         The JSON path
+ * @param CompiledPath Used to return the compiled path
+ * @return A true value if the path was compiled.
+ * @return A false value if the path is invalid or could not be compiled (the compiled path will have no components).
+ * @note The compiled path does not refer to \a `Path` once it is compiled
+ * @note Use \a `JsonPathCleanUpCompiled()` to clean up the compiled path when it is no longer required (whatever the return value)
+ */
+bool JsonPathCompile(tJsonPath Path, tJsonCompiledPath *CompiledPath);
+
+
+/**
+ * @brief Cleans up a compiled JSON path
+ * @param CompiledPath The compiled path to clean up
+ * @return None
+ */
+void JsonPathCleanUpCompiled(tJsonCompiledPath *CompiledPath);
+
+
 #endif
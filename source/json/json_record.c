@@ -0,0 +1,665 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include "json_character.h"
+#include "json_record.h"
+#include "json_scan.h"
+#include "json_stats.h"
+
+
+static bool JsonRecordReserveContent(tJsonRecordBatch *Batch, size_t Length)
+{
+	uint8_t *Content;
+	size_t Size;
+
+	if (Length > Batch->Size)
+	{
+		for (Size = (Batch->Size != 0) ? Batch->Size : JSON_RECORD_BATCH_SIZE; Size < Length; Size = Size * 2)
+			;
+		Content = (uint8_t *)JSON_STATS_REALLOC(json_StatsRecord, Batch->Content, Size);
+		if (Content == NULL)
+		{
+			return false;
+		}
+		Batch->Content = Content;
+		Batch->Size = Size;
+	}
+
+	return true;
+}
+
+
+static bool JsonRecordAddEnd(tJsonRecordBatch *Batch, size_t End)
+{
+	size_t *EndList;
+	tJsonElement *Root;
+	bool *Valid;
+	size_t RecordSize;
+
+	if (Batch->Count == Batch->RecordSize)
+	{
+		RecordSize = (Batch->RecordSize != 0) ? Batch->RecordSize * 2 : 64;
+		EndList = (size_t *)JSON_STATS_REALLOC(json_StatsRecord, Batch->End, RecordSize * sizeof(size_t));
+		if (EndList == NULL)
+		{
+			return false;
+		}
+		Batch->End = EndList;
+		Root = (tJsonElement *)JSON_STATS_REALLOC(json_StatsRecord, Batch->Root, RecordSize * sizeof(tJsonElement));
+		if (Root == NULL)
+		{
+			return false;
+		}
+		Batch->Root = Root;
+		Valid = (bool *)JSON_STATS_REALLOC(json_StatsRecord, Batch->Valid, RecordSize * sizeof(bool));
+		if (Valid == NULL)
+		{
+			return false;
+		}
+		Batch->Valid = Valid;
+		Batch->RecordSize = RecordSize;
+	}
+
+	Batch->End[Batch->Count] = End;
+	Batch->Count++;
+
+	return true;
+}
+
+
+static void JsonRecordScanEnd(tJsonRecordParse *Record, bool *IsEnd)
+{
+	Record->State = json_RecordScanStart;
+	Record->Depth = 0;
+	Record->HasValue = false;
+	*IsEnd = true;
+}
+
+
+static size_t JsonRecordScan(tJsonRecordParse *Record, const uint8_t *Content, size_t Length, bool *IsEnd)
+{
+	size_t Offset = 0;
+	uint8_t Byte;
+
+	*IsEnd = false;
+
+	while (Offset < Length)
+	{
+		Byte = Content[Offset];
+		switch (Record->State)
+		{
+			case json_RecordScanStart:
+				if (Byte == '/')
+				{
+					Record->CommentState = json_RecordScanStart;
+					Record->State = json_RecordScanComment;
+				}
+				else if ((Byte == '{') || (Byte == '['))
+				{
+					Record->Depth = 1;
+					Record->HasValue = true;
+					Record->State = json_RecordScanValue;
+				}
+				else if (Byte == '"')
+				{
+					Record->HasValue = true;
+					Record->State = json_RecordScanString;
+				}
+				else if (JsonCharacterIsLiteral(Byte))
+				{
+					Record->HasValue = true;
+					Record->State = json_RecordScanLiteral;
+				}
+				else if (!JsonCharacterIsWhitespace(Byte))
+				{
+					JsonRecordScanEnd(Record, IsEnd);
+					return Offset + 1;
+				}
+			break;
+
+			case json_RecordScanValue:
+				if (Byte == '"')
+				{
+					Record->State = json_RecordScanString;
+				}
+				else if ((Byte == '{') || (Byte == '['))
+				{
+					Record->Depth++;
+				}
+				else if ((Byte == '}') || (Byte == ']'))
+				{
+					Record->Depth--;
+					if (Record->Depth == 0)
+					{
+						JsonRecordScanEnd(Record, IsEnd);
+						return Offset + 1;
+					}
+				}
+				else if (Byte == '/')
+				{
+					Record->CommentState = json_RecordScanValue;
+					Record->State = json_RecordScanComment;
+				}
+			break;
+
+			case json_RecordScanString:
+				Offset = Offset + JsonScanString(&Content[Offset], Length - Offset);
+				if (Offset == Length)
+				{
+					return Offset;
+				}
+				else if (Content[Offset] == '\\')
+				{
+					Record->State = json_RecordScanEscape;
+				}
+				else if ((Content[Offset] == '"') && (Record->Depth == 0))
+				{
+					JsonRecordScanEnd(Record, IsEnd);
+					return Offset + 1;
+				}
+				else if (Content[Offset] == '"')
+				{
+					Record->State = json_RecordScanValue;
+				}
+			break;
+
+			case json_RecordScanEscape:
+				Record->State = json_RecordScanString;
+			break;
+
+			case json_RecordScanLiteral:
+				if (!JsonCharacterIsLiteral(Byte))
+				{
+					JsonRecordScanEnd(Record, IsEnd);
+					return Offset;
+				}
+			break;
+
+			case json_RecordScanComment:
+				if (Byte == '/')
+				{
+					Record->State = json_RecordScanCommentLine;
+				}
+				else if (Byte == '*')
+				{
+					Record->State = json_RecordScanCommentBlock;
+				}
+				else
+				{
+					Record->State = Record->CommentState;
+					continue;
+				}
+			break;
+
+			case json_RecordScanCommentLine:
+				if ((Byte == '\r') || (Byte == '\n'))
+				{
+					Record->State = Record->CommentState;
+				}
+			break;
+
+			case json_RecordScanCommentBlock:
+				if (Byte == '*')
+				{
+					Record->State = json_RecordScanCommentEnd;
+				}
+			break;
+
+			case json_RecordScanCommentEnd:
+				if (Byte == '/')
+				{
+					Record->State = Record->CommentState;
+				}
+				else if (Byte != '*')
+				{
+					Record->State = json_RecordScanCommentBlock;
+				}
+			break;
+		}
+		Offset++;
+	}
+
+	return Offset;
+}
+
+
+static void JsonRecordParseBatch(const tJsonRecordParse *Record, tJsonRecordBatch *Batch)
+{
+	tJsonParse Parse;
+	size_t Start;
+	size_t n;
+	int State;
+
+	for (Start = 0, n = 0; n < Batch->Count; Start = Batch->End[n], n++)
+	{
+		JsonElementSetUp(&Batch->Root[n]);
+		JsonParseSetUp(&Parse, Record->StripComments, &Batch->Root[n]);
+
+		State = JsonParse(&Parse, json_Utf8, &Batch->Content[Start], Batch->End[n] - Start, NULL);
+		if (State == JSON_PARSE_INCOMPLETE)
+		{
+			State = JsonParse(&Parse, json_Utf8, (const uint8_t *)"", 1, NULL);
+		}
+		Batch->Valid[n] = (State == JSON_PARSE_COMPLETE);
+
+		JsonParseCleanUp(&Parse);
+	}
+}
+
+
+static tJsonRecordBatch *JsonRecordGetReady(tJsonRecordParse *Record)
+{
+	tJsonRecordBatch *Ready = NULL;
+	size_t n;
+
+	for (n = 0; n < Record->BatchCount; n++)
+	{
+		if ((Record->Batch[n].State == json_RecordBatchReady) && ((Ready == NULL) || (Record->Batch[n].Sequence < Ready->Sequence)))
+		{
+			Ready = &Record->Batch[n];
+		}
+	}
+
+	return Ready;
+}
+
+
+static void *JsonRecordWorker(void *Argument)
+{
+	tJsonRecordParse *Record = (tJsonRecordParse *)Argument;
+	tJsonRecordBatch *Batch;
+
+	pthread_mutex_lock(&Record->Mutex);
+
+	while (!Record->Stopping)
+	{
+		Batch = JsonRecordGetReady(Record);
+		if (Batch == NULL)
+		{
+			pthread_cond_wait(&Record->Ready, &Record->Mutex);
+			continue;
+		}
+
+		Batch->State = json_RecordBatchParsing;
+		pthread_mutex_unlock(&Record->Mutex);
+
+		JsonRecordParseBatch(Record, Batch);
+
+		pthread_mutex_lock(&Record->Mutex);
+		Batch->State = json_RecordBatchParsed;
+		pthread_cond_broadcast(&Record->Parsed);
+	}
+
+	pthread_mutex_unlock(&Record->Mutex);
+
+	return NULL;
+}
+
+
+static void JsonRecordClearBatch(tJsonRecordBatch *Batch)
+{
+	size_t n;
+
+	if (Batch->State == json_RecordBatchParsed)
+	{
+		for (n = 0; n < Batch->Count; n++)
+		{
+			JsonElementCleanUp(&Batch->Root[n]);
+		}
+	}
+
+	Batch->State = json_RecordBatchEmpty;
+	Batch->Length = 0;
+	Batch->Scanned = 0;
+	Batch->Count = 0;
+}
+
+
+static bool JsonRecordDeliver(tJsonRecordParse *Record, bool Wait)
+{
+	tJsonRecordBatch *Batch;
+	bool IsWaiting;
+	size_t n;
+
+	pthread_mutex_lock(&Record->Mutex);
+
+	for (;;)
+	{
+		Batch = NULL;
+		IsWaiting = false;
+		for (n = 0; n < Record->BatchCount; n++)
+		{
+			if ((Record->Batch[n].State == json_RecordBatchParsed) && (Record->Unordered || (Record->Batch[n].Sequence == Record->Delivered)))
+			{
+				Batch = &Record->Batch[n];
+				break;
+			}
+			IsWaiting = IsWaiting || (Record->Batch[n].State == json_RecordBatchReady) || (Record->Batch[n].State == json_RecordBatchParsing) || (Record->Batch[n].State == json_RecordBatchParsed);
+		}
+
+		if ((Batch != NULL) || !Wait || !IsWaiting)
+		{
+			break;
+		}
+		pthread_cond_wait(&Record->Parsed, &Record->Mutex);
+	}
+
+	pthread_mutex_unlock(&Record->Mutex);
+
+	if (Batch == NULL)
+	{
+		return false;
+	}
+
+	for (n = 0; (n < Batch->Count) && !Record->Stopped; n++)
+	{
+		if (!Record->Callback(Record->Context, Batch->Index + n, Batch->Valid[n] ? &Batch->Root[n] : NULL))
+		{
+			Record->Stopped = true;
+		}
+	}
+
+	pthread_mutex_lock(&Record->Mutex);
+	JsonRecordClearBatch(Batch);
+	Record->Delivered++;
+	pthread_mutex_unlock(&Record->Mutex);
+
+	return true;
+}
+
+
+static tJsonRecordBatch *JsonRecordAcquire(tJsonRecordParse *Record)
+{
+	tJsonRecordBatch *Batch;
+	size_t n;
+
+	for (;;)
+	{
+		Batch = NULL;
+
+		pthread_mutex_lock(&Record->Mutex);
+		for (n = 0; (n < Record->BatchCount) && (Batch == NULL); n++)
+		{
+			if (Record->Batch[n].State == json_RecordBatchEmpty)
+			{
+				Batch = &Record->Batch[n];
+				Batch->State = json_RecordBatchFilling;
+				Batch->Index = Record->RecordCount;
+			}
+		}
+		pthread_mutex_unlock(&Record->Mutex);
+
+		if (Batch != NULL)
+		{
+			return Batch;
+		}
+		else if (!JsonRecordDeliver(Record, true))
+		{
+			return NULL;
+		}
+	}
+}
+
+
+static void JsonRecordSubmit(tJsonRecordParse *Record, tJsonRecordBatch *Batch)
+{
+	pthread_mutex_lock(&Record->Mutex);
+
+	Batch->Sequence = Record->Sequence;
+	Record->Sequence++;
+
+	if (Record->ThreadCount == 0)
+	{
+		pthread_mutex_unlock(&Record->Mutex);
+		JsonRecordParseBatch(Record, Batch);
+		pthread_mutex_lock(&Record->Mutex);
+		Batch->State = json_RecordBatchParsed;
+	}
+	else
+	{
+		Batch->State = json_RecordBatchReady;
+		pthread_cond_signal(&Record->Ready);
+	}
+
+	pthread_mutex_unlock(&Record->Mutex);
+}
+
+
+static bool JsonRecordSplit(tJsonRecordParse *Record)
+{
+	tJsonRecordBatch *Batch = Record->Filling;
+	tJsonRecordBatch *Next;
+	size_t Length;
+
+	Next = JsonRecordAcquire(Record);
+	if (Next == NULL)
+	{
+		return false;
+	}
+
+	Length = Batch->Length - Batch->Scanned;
+	if (!JsonRecordReserveContent(Next, Length))
+	{
+		pthread_mutex_lock(&Record->Mutex);
+		JsonRecordClearBatch(Next);
+		pthread_mutex_unlock(&Record->Mutex);
+		return false;
+	}
+
+	memcpy(Next->Content, &Batch->Content[Batch->Scanned], Length);
+	Next->Length = Length;
+	Batch->Length = Batch->Scanned;
+
+	JsonRecordSubmit(Record, Batch);
+	Record->Filling = Next;
+
+	return true;
+}
+
+
+static bool JsonRecordScanBatch(tJsonRecordParse *Record)
+{
+	tJsonRecordBatch *Batch = Record->Filling;
+	bool IsEnd;
+
+	while (Batch->Scanned < Batch->Length)
+	{
+		Batch->Scanned = Batch->Scanned + JsonRecordScan(Record, &Batch->Content[Batch->Scanned], Batch->Length - Batch->Scanned, &IsEnd);
+		if (IsEnd)
+		{
+			if (!JsonRecordAddEnd(Batch, Batch->Scanned))
+			{
+				return false;
+			}
+			Record->RecordCount++;
+
+			if (Batch->Scanned >= JSON_RECORD_BATCH_SIZE)
+			{
+				if (!JsonRecordSplit(Record))
+				{
+					return false;
+				}
+				Batch = Record->Filling;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+bool JsonRecordSetUp(tJsonRecordParse *Record, size_t ThreadCount, bool StripComments, bool Unordered, tJsonRecordCallback Callback, void *Context)
+{
+	size_t n;
+
+	Record->Callback = Callback;
+	Record->Context = Context;
+	Record->StripComments = StripComments;
+	Record->Unordered = Unordered;
+	Record->Stopped = false;
+	Record->Stopping = false;
+	Record->State = json_RecordScanStart;
+	Record->CommentState = json_RecordScanStart;
+	Record->Depth = 0;
+	Record->HasValue = false;
+	Record->RecordCount = 0;
+	Record->Sequence = 0;
+	Record->Delivered = 0;
+	Record->Filling = NULL;
+	Record->ThreadCount = 0;
+	pthread_mutex_init(&Record->Mutex, NULL);
+	pthread_cond_init(&Record->Ready, NULL);
+	pthread_cond_init(&Record->Parsed, NULL);
+
+	Record->BatchCount = (ThreadCount + 1) * JSON_RECORD_BATCHES_PER_THREAD;
+	Record->Batch = (tJsonRecordBatch *)JSON_STATS_MALLOC(json_StatsRecord, Record->BatchCount * sizeof(tJsonRecordBatch));
+	Record->Thread = (ThreadCount != 0) ? (pthread_t *)JSON_STATS_MALLOC(json_StatsRecord, ThreadCount * sizeof(pthread_t)) : NULL;
+	if ((Record->Batch == NULL) || ((ThreadCount != 0) && (Record->Thread == NULL)))
+	{
+		Record->BatchCount = 0;
+		Record->Stopped = true;
+		return false;
+	}
+
+	memset(Record->Batch, 0, Record->BatchCount * sizeof(tJsonRecordBatch));
+
+	for (n = 0; n < ThreadCount; n++)
+	{
+		if (pthread_create(&Record->Thread[n], NULL, JsonRecordWorker, Record) != 0)
+		{
+			Record->Stopped = true;
+			return false;
+		}
+		Record->ThreadCount++;
+	}
+
+	return true;
+}
+
+
+void JsonRecordCleanUp(tJsonRecordParse *Record)
+{
+	size_t n;
+
+	pthread_mutex_lock(&Record->Mutex);
+	Record->Stopping = true;
+	pthread_cond_broadcast(&Record->Ready);
+	pthread_mutex_unlock(&Record->Mutex);
+
+	for (n = 0; n < Record->ThreadCount; n++)
+	{
+		pthread_join(Record->Thread[n], NULL);
+	}
+
+	for (n = 0; n < Record->BatchCount; n++)
+	{
+		JsonRecordClearBatch(&Record->Batch[n]);
+		JSON_STATS_FREE(json_StatsRecord, Record->Batch[n].Content);
+		JSON_STATS_FREE(json_StatsRecord, Record->Batch[n].End);
+		JSON_STATS_FREE(json_StatsRecord, Record->Batch[n].Root);
+		JSON_STATS_FREE(json_StatsRecord, Record->Batch[n].Valid);
+	}
+
+	JSON_STATS_FREE(json_StatsRecord, Record->Batch);
+	JSON_STATS_FREE(json_StatsRecord, Record->Thread);
+
+	pthread_cond_destroy(&Record->Parsed);
+	pthread_cond_destroy(&Record->Ready);
+	pthread_mutex_destroy(&Record->Mutex);
+
+	Record->Batch = NULL;
+	Record->BatchCount = 0;
+	Record->Thread = NULL;
+	Record->ThreadCount = 0;
+	Record->Filling = NULL;
+	Record->Callback = NULL;
+	Record->Context = NULL;
+}
+
+
+bool JsonRecordRead(tJsonRecordParse *Record, const uint8_t *Content, size_t Length)
+{
+	tJsonRecordBatch *Batch;
+	size_t Part;
+
+	while (!Record->Stopped && (Length > 0))
+	{
+		if (Record->Filling == NULL)
+		{
+			Record->Filling = JsonRecordAcquire(Record);
+			if (Record->Filling == NULL)
+			{
+				Record->Stopped = true;
+				break;
+			}
+		}
+
+		Batch = Record->Filling;
+		Part = (Length < JSON_RECORD_BATCH_SIZE) ? Length : JSON_RECORD_BATCH_SIZE;
+		if (!JsonRecordReserveContent(Batch, Batch->Length + Part))
+		{
+			Record->Stopped = true;
+			break;
+		}
+
+		memcpy(&Batch->Content[Batch->Length], Content, Part);
+		Batch->Length = Batch->Length + Part;
+		Content = Content + Part;
+		Length = Length - Part;
+
+		if (!JsonRecordScanBatch(Record))
+		{
+			Record->Stopped = true;
+			break;
+		}
+
+		while (JsonRecordDeliver(Record, false))
+			;
+	}
+
+	return !Record->Stopped;
+}
+
+
+bool JsonRecordFinish(tJsonRecordParse *Record)
+{
+	tJsonRecordBatch *Batch = Record->Filling;
+
+	if (Batch != NULL)
+	{
+		if (!Record->Stopped && Record->HasValue)
+		{
+			if (JsonRecordAddEnd(Batch, Batch->Length))
+			{
+				Record->RecordCount++;
+			}
+			else
+			{
+				Record->Stopped = true;
+			}
+		}
+
+		if (!Record->Stopped && (Batch->Count != 0))
+		{
+			Batch->Length = Batch->End[Batch->Count - 1];
+			JsonRecordSubmit(Record, Batch);
+		}
+		else
+		{
+			pthread_mutex_lock(&Record->Mutex);
+			JsonRecordClearBatch(Batch);
+			pthread_mutex_unlock(&Record->Mutex);
+		}
+
+		Record->Filling = NULL;
+	}
+
+	Record->State = json_RecordScanStart;
+	Record->Depth = 0;
+	Record->HasValue = false;
+
+	while (JsonRecordDeliver(Record, true))
+		;
+
+	return !Record->Stopped;
+}
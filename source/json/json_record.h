@@ -0,0 +1,158 @@
+#ifndef JSON_RECORD_H
+#define JSON_RECORD_H
+
+#include <pthread.h>
+#include "json_parse.h"
+
+
+/**
+ * @brief The number of bytes of records that are collected into a batch before the batch is parsed (a batch only holds whole records, so it can be larger)
+ */
+#define JSON_RECORD_BATCH_SIZE 65536
+
+
+/**
+ * @brief The number of batches that are used for each worker thread (so that the next batches are ready when a worker finishes one)
+ */
+#define JSON_RECORD_BATCHES_PER_THREAD 2
+
+
+/**
+ * @brief Type used for a function that is called for each record
+ * @param Context The context passed to \a `JsonRecordSetUp()`
+ * @param Index   The index of the record (zero for the first record in the content)
+ * @param Root    The root element of the record (or \a `NULL` if the record could not be parsed)
+ * @return A true value should be returned to continue reading records.
+ * @return A false value should be returned to stop reading records (with an error).
+ * @note The function is always called from the thread that passes the content to the reader. The elements of the record are freed once the function returns (use \a `JsonElementMoveChild()` to keep them).
+ */
+typedef bool (* tJsonRecordCallback)(void *Context, size_t Index, tJsonElement *Root);
+
+
+/**
+ * @brief Enumeration used to define the states used to find the end of each record
+ */
+typedef enum
+{
+	json_RecordScanStart,        /**< Looking for the start of the record value (skipping whitespace and comments) */
+	json_RecordScanValue,        /**< Inside an object or array */
+	json_RecordScanString,       /**< Inside a string */
+	json_RecordScanEscape,       /**< Inside a string, after a reverse solidus */
+	json_RecordScanLiteral,      /**< Inside a literal that is not inside an object or array */
+	json_RecordScanComment,      /**< After the solidus that starts a comment */
+	json_RecordScanCommentLine,  /**< Inside a line comment */
+	json_RecordScanCommentBlock, /**< Inside a block comment */
+	json_RecordScanCommentEnd    /**< Inside a block comment, after an asterisk */
+} tJsonRecordScanState;
+
+
+/**
+ * @brief Enumeration used to define the states of a batch of records
+ */
+typedef enum
+{
+	json_RecordBatchEmpty,   /**< The batch is not being used */
+	json_RecordBatchFilling, /**< Records are being added to the batch */
+	json_RecordBatchReady,   /**< The batch is waiting for a worker thread to parse it */
+	json_RecordBatchParsing, /**< The batch is being parsed by a worker thread */
+	json_RecordBatchParsed   /**< The batch has been parsed and is waiting for its records to be delivered */
+} tJsonRecordBatchState;
+
+
+/**
+ * @brief Type used for a batch of records that are parsed together by one worker thread
+ */
+typedef struct
+{
+	tJsonRecordBatchState State;       /**< The state of the batch */
+	size_t                Sequence;    /**< The order in which the batch was filled */
+	size_t                Index;       /**< The index of the first record in the batch */
+	uint8_t              *Content;     /**< The UTF-8 encoded content of the records (and of the start of the next record) */
+	size_t                Length;      /**< The length of the content */
+	size_t                Size;        /**< The number of bytes that have been allocated for the content */
+	size_t                Scanned;     /**< The length of the content that has been scanned for the end of a record */
+	size_t               *End;         /**< The offset to the end of each record in the content */
+	tJsonElement         *Root;        /**< The root element of each record */
+	bool                 *Valid;       /**< Indicates whether each record was parsed successfully */
+	size_t                Count;       /**< The number of records in the batch */
+	size_t                RecordSize;  /**< The number of records that have been allocated */
+} tJsonRecordBatch;
+
+
+/**
+ * @brief Type used for reading a sequence of JSON documents (such as newline delimited JSON) with a pool of worker threads
+ * @note The content is split into records (one top level value each, with any whitespace and comments before it) on the calling thread. The records are collected into batches that are parsed by the worker threads - each record gets its own root element.
+ */
+typedef struct
+{
+	tJsonRecordCallback  Callback;      /**< The function to call for each record */
+	void                *Context;       /**< The context to pass to the callback function */
+	bool                 StripComments; /**< Indicates whether to strip or keep any comments that are in the records */
+	bool                 Unordered;     /**< Indicates whether the records can be delivered as soon as their batch is parsed (instead of in order) */
+	bool                 Stopped;       /**< Indicates whether reading was stopped (by the callback function or a memory allocation failure) */
+	bool                 Stopping;      /**< Indicates whether the worker threads should exit */
+	tJsonRecordScanState State;         /**< The state used to find the end of the record being scanned */
+	tJsonRecordScanState CommentState;  /**< The state to restore at the end of a comment */
+	size_t               Depth;         /**< The nesting depth of the record being scanned */
+	bool                 HasValue;      /**< Indicates whether the value of the record being scanned has started */
+	size_t               RecordCount;   /**< The number of records that have been found */
+	size_t               Sequence;      /**< The sequence number of the next batch to fill */
+	size_t               Delivered;     /**< The sequence number of the next batch to deliver (when delivering in order) */
+	tJsonRecordBatch    *Batch;         /**< The batches */
+	size_t               BatchCount;    /**< The number of batches */
+	tJsonRecordBatch    *Filling;       /**< The batch that records are being added to (or \a `NULL`) */
+	pthread_t           *Thread;        /**< The worker threads */
+	size_t               ThreadCount;   /**< The number of worker threads that are running */
+	pthread_mutex_t      Mutex;         /**< Protects the batch states (and the \a `Stopping` flag) */
+	pthread_cond_t       Ready;         /**< Signalled when a batch is ready to be parsed (or the worker threads should exit) */
+	pthread_cond_t       Parsed;        /**< Signalled when a batch has been parsed */
+} tJsonRecordParse;
+
+
+/**
+ * @brief Sets up a record reader (and starts its worker threads)
+ * @param Record        The record reader to set up
+ * @param ThreadCount   The number of worker threads to use (zero parses each batch on the calling thread)
+ * @param StripComments Indicates whether comments should be stripped from the records
+ * @param Unordered     Indicates whether the records can be delivered out of order (the records of a batch are still delivered in order)
+ * @param Callback      The function to call for each record
+ * @param Context       The context to pass to the callback function
+ * @return A true value is returned if the record reader was set up.
+ * @return A false value is returned if the record reader could not be set up (there was not enough memory or a worker thread could not be started).
+ * @note Use \a `JsonRecordCleanUp()` to clean up the record reader when it is no longer required (even if it could not be set up).
+ */
+bool JsonRecordSetUp(tJsonRecordParse *Record, size_t ThreadCount, bool StripComments, bool Unordered, tJsonRecordCallback Callback, void *Context);
+
+
+/**
+ * @brief Cleans up a record reader (and stops its worker threads)
+ * @param Record The record reader to clean up
+ * @return None
+ * @note Any records that have not been delivered yet are discarded.
+ */
+void JsonRecordCleanUp(tJsonRecordParse *Record);
+
+
+/**
+ * @brief Reads the next part of the content of a sequence of records
+ * @param Record  The record reader
+ * @param Content The next part of the UTF-8 encoded content (it can end at any byte)
+ * @param Length  The length of the content
+ * @return A true value is returned if the content was read.
+ * @return A false value is returned if reading was stopped (see \a `tJsonRecordCallback`) or there was not enough memory.
+ * @note The content is copied into the batches, so it does not need to remain valid once the function returns. The callback function is called for any records that have been parsed by then.
+ */
+bool JsonRecordRead(tJsonRecordParse *Record, const uint8_t *Content, size_t Length);
+
+
+/**
+ * @brief Finishes reading a sequence of records (and waits for all of them to be delivered)
+ * @param Record The record reader
+ * @return A true value is returned if all of the records were delivered.
+ * @return A false value is returned if reading was stopped (see \a `tJsonRecordCallback`) or there was not enough memory.
+ * @note Any content after the last record that is not just whitespace or comments is delivered as a record (that cannot be parsed).
+ */
+bool JsonRecordFinish(tJsonRecordParse *Record);
+
+
+#endif
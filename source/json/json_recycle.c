@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <string.h>
+#include "json_recycle.h"
+#include "json_stats.h"
+
+
+static size_t JsonRecycleGetClass(size_t Size)
+{
+	size_t ClassSize;
+	size_t Class;
+
+	if ((Size == 0) || (Size > JSON_RECYCLE_MAX_SIZE))
+	{
+		return JSON_RECYCLE_CLASS_COUNT;
+	}
+	else if (Size <= JSON_RECYCLE_CLASS_SIZE * JSON_RECYCLE_SMALL_CLASS_COUNT)
+	{
+		return (Size - 1) / JSON_RECYCLE_CLASS_SIZE;
+	}
+
+	for (Class = JSON_RECYCLE_SMALL_CLASS_COUNT, ClassSize = 2 * JSON_RECYCLE_CLASS_SIZE * JSON_RECYCLE_SMALL_CLASS_COUNT; ClassSize < Size; Class++)
+	{
+		ClassSize = 2 * ClassSize;
+	}
+
+	return Class;
+}
+
+
+static size_t JsonRecycleGetClassSize(size_t Class)
+{
+	if (Class < JSON_RECYCLE_SMALL_CLASS_COUNT)
+	{
+		return (Class + 1) * JSON_RECYCLE_CLASS_SIZE;
+	}
+
+	return ((size_t)JSON_RECYCLE_CLASS_SIZE * JSON_RECYCLE_SMALL_CLASS_COUNT) << (Class - JSON_RECYCLE_SMALL_CLASS_COUNT + 1);
+}
+
+
+static void *JsonRecycleAllocatorAllocate(void *Context, size_t Size)
+{
+	return JsonRecycleAllocate((tJsonRecycle *)Context, Size);
+}
+
+
+static void *JsonRecycleAllocatorReallocate(void *Context, void *Memory, size_t Size, size_t NewSize)
+{
+	return JsonRecycleReallocate((tJsonRecycle *)Context, Memory, Size, NewSize);
+}
+
+
+static void JsonRecycleAllocatorFree(void *Context, void *Memory, size_t Size)
+{
+	JsonRecycleFree((tJsonRecycle *)Context, Memory, Size);
+}
+
+
+void JsonRecycleSetUp(tJsonRecycle *Recycle)
+{
+	size_t Class;
+
+	for (Class = 0; Class < JSON_RECYCLE_CLASS_COUNT; Class++)
+	{
+		Recycle->Block[Class] = NULL;
+		Recycle->Last[Class] = NULL;
+	}
+	Recycle->Count = 0;
+}
+
+
+void JsonRecycleCleanUp(tJsonRecycle *Recycle)
+{
+	JsonRecycleClear(Recycle);
+}
+
+
+void JsonRecycleClear(tJsonRecycle *Recycle)
+{
+	tJsonRecycleBlock *Block;
+	size_t Class;
+
+	for (Class = 0; Class < JSON_RECYCLE_CLASS_COUNT; Class++)
+	{
+		while (Recycle->Block[Class] != NULL)
+		{
+			Block = Recycle->Block[Class];
+			Recycle->Block[Class] = Block->Next;
+			JSON_STATS_FREE(json_StatsRecycle, Block);
+			Recycle->Count--;
+		}
+		Recycle->Last[Class] = NULL;
+	}
+}
+
+
+void *JsonRecycleAllocate(tJsonRecycle *Recycle, size_t Size)
+{
+	tJsonRecycleBlock *Block;
+	size_t Class;
+
+	if (Size == 0)
+	{
+		return NULL;
+	}
+
+	Class = JsonRecycleGetClass(Size);
+	if (Class < JSON_RECYCLE_CLASS_COUNT)
+	{
+		Block = Recycle->Block[Class];
+		if (Block != NULL)
+		{
+			Recycle->Block[Class] = Block->Next;
+			return Block;
+		}
+
+		Size = JsonRecycleGetClassSize(Class);
+	}
+
+	Block = (tJsonRecycleBlock *)JSON_STATS_MALLOC(json_StatsRecycle, Size);
+	if (Block != NULL)
+	{
+		Recycle->Count++;
+	}
+
+	return Block;
+}
+
+
+void *JsonRecycleReallocate(tJsonRecycle *Recycle, void *Memory, size_t Size, size_t NewSize)
+{
+	void *NewMemory;
+	size_t Class;
+
+	if (Memory == NULL)
+	{
+		return JsonRecycleAllocate(Recycle, NewSize);
+	}
+
+	Class = JsonRecycleGetClass(Size);
+	if ((Size != 0) && (NewSize != 0) && (Class == JsonRecycleGetClass(NewSize)))
+	{
+		return (Class < JSON_RECYCLE_CLASS_COUNT) ? Memory : JSON_STATS_REALLOC(json_StatsRecycle, Memory, NewSize);
+	}
+
+	NewMemory = JsonRecycleAllocate(Recycle, NewSize);
+	if (NewMemory != NULL)
+	{
+		memcpy(NewMemory, Memory, (Size < NewSize) ? Size : NewSize);
+		JsonRecycleFree(Recycle, Memory, Size);
+	}
+
+	return NewMemory;
+}
+
+
+void JsonRecycleFree(tJsonRecycle *Recycle, void *Memory, size_t Size)
+{
+	tJsonRecycleBlock *Block = (tJsonRecycleBlock *)Memory;
+	size_t Class;
+
+	if (Block != NULL)
+	{
+		Class = JsonRecycleGetClass(Size);
+		if (Class < JSON_RECYCLE_CLASS_COUNT)
+		{
+			Block->Next = NULL;
+			if (Recycle->Block[Class] == NULL)
+			{
+				Recycle->Block[Class] = Block;
+			}
+			else
+			{
+				Recycle->Last[Class]->Next = Block;
+			}
+			Recycle->Last[Class] = Block;
+		}
+		else
+		{
+			JSON_STATS_FREE(json_StatsRecycle, Block);
+			Recycle->Count--;
+		}
+	}
+}
+
+
+void JsonRecycleGetAllocator(tJsonRecycle *Recycle, tJsonAllocator *Allocator)
+{
+	Allocator->Allocate = JsonRecycleAllocatorAllocate;
+	Allocator->Reallocate = JsonRecycleAllocatorReallocate;
+	Allocator->Free = JsonRecycleAllocatorFree;
+	Allocator->Context = Recycle;
+}
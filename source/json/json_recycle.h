@@ -0,0 +1,128 @@
+#ifndef JSON_RECYCLE_H
+#define JSON_RECYCLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_allocator.h"
+
+
+/**
+ * @brief The difference in size (in bytes) between each small class of recycled memory blocks
+ */
+#define JSON_RECYCLE_CLASS_SIZE 16
+
+
+/**
+ * @brief The number of small classes of recycled memory blocks
+ */
+#define JSON_RECYCLE_SMALL_CLASS_COUNT 32
+
+
+/**
+ * @brief The number of large classes of recycled memory blocks (each one is twice the size of the one before it, starting from twice the size of the largest small class)
+ */
+#define JSON_RECYCLE_LARGE_CLASS_COUNT 12
+
+
+/**
+ * @brief The number of classes of recycled memory blocks
+ */
+#define JSON_RECYCLE_CLASS_COUNT (JSON_RECYCLE_SMALL_CLASS_COUNT + JSON_RECYCLE_LARGE_CLASS_COUNT)
+
+
+/**
+ * @brief The size (in bytes) of the largest class of recycled memory blocks (larger allocations are not recycled)
+ */
+#define JSON_RECYCLE_MAX_SIZE (((size_t)JSON_RECYCLE_CLASS_SIZE * JSON_RECYCLE_SMALL_CLASS_COUNT) << JSON_RECYCLE_LARGE_CLASS_COUNT)
+
+
+/**
+ * @brief Type used for a memory block that has been freed to a recycling allocator
+ */
+typedef struct tJsonRecycleBlock
+{
+	struct tJsonRecycleBlock *Next; /**< The next freed block of the same class */
+} tJsonRecycleBlock;
+
+
+/**
+ * @brief Type used for a recycling memory allocator (that keeps freed memory blocks in a free list for each size class so that they can be reused)
+ */
+typedef struct tJsonRecycle
+{
+	tJsonRecycleBlock *Block[JSON_RECYCLE_CLASS_COUNT]; /**< The freed blocks of each class (in the order that they were freed) */
+	tJsonRecycleBlock *Last[JSON_RECYCLE_CLASS_COUNT];  /**< The last freed block of each class */
+	size_t             Count;                           /**< The number of blocks (allocated or freed) that are held by the allocator */
+} tJsonRecycle;
+
+
+/**
+ * @brief Sets up a recycling allocator
+ * @param Recycle The recycling allocator to set up
+ * @return None
+ * @note Use \a `JsonRecycleCleanUp()` to clean up the recycling allocator when it is no longer required
+ */
+void JsonRecycleSetUp(tJsonRecycle *Recycle);
+
+
+/**
+ * @brief Cleans up a recycling allocator
+ * @param Recycle The recycling allocator to clean up
+ * @return None
+ * @note All of the freed blocks are returned to the heap - any memory that is still allocated must be freed first (with \a `JsonRecycleFree()`).
+ */
+void JsonRecycleCleanUp(tJsonRecycle *Recycle);
+
+
+/**
+ * @brief Clears a recycling allocator (returning all of the freed blocks to the heap)
+ * @param Recycle The recycling allocator to clear
+ * @return None
+ */
+void JsonRecycleClear(tJsonRecycle *Recycle);
+
+
+/**
+ * @brief Allocates memory from a recycling allocator
+ * @param Recycle The recycling allocator
+ * @param Size    The size (in bytes) of the memory to allocate
+ * @return A pointer to the allocated memory (the first freed block of the same class is reused if there is one).
+ * @return A \a `NULL` value is returned if the memory could not be allocated.
+ */
+void *JsonRecycleAllocate(tJsonRecycle *Recycle, size_t Size);
+
+
+/**
+ * @brief Reallocates memory from a recycling allocator
+ * @param Recycle The recycling allocator
+ * @param Memory  The memory that was previously allocated from the recycling allocator (or \a `NULL`)
+ * @param Size    The current size (in bytes) of the memory
+ * @param NewSize The new size (in bytes) of the memory
+ * @return A pointer to the reallocated memory (the same memory if the new size is in the same class as the current size).
+ * @return A \a `NULL` value is returned if the memory could not be reallocated (the original memory is left unchanged).
+ */
+void *JsonRecycleReallocate(tJsonRecycle *Recycle, void *Memory, size_t Size, size_t NewSize);
+
+
+/**
+ * @brief Frees memory to a recycling allocator
+ * @param Recycle The recycling allocator
+ * @param Memory  The memory that was previously allocated from the recycling allocator (or \a `NULL`)
+ * @param Size    The size (in bytes) of the memory
+ * @return None
+ * @note The memory is kept by the recycling allocator for reuse (unless it is larger than \a `JSON_RECYCLE_MAX_SIZE`).
+ * @note Freed blocks are reused in the order that they were freed so that a tree that is cleared and then allocated again keeps the same memory layout.
+ */
+void JsonRecycleFree(tJsonRecycle *Recycle, void *Memory, size_t Size);
+
+
+/**
+ * @brief Gets an allocator that allocates memory from a recycling allocator
+ * @param Recycle   The recycling allocator
+ * @param Allocator Updated with the allocator (which must not be used after the recycling allocator has been cleaned up)
+ * @return None
+ */
+void JsonRecycleGetAllocator(tJsonRecycle *Recycle, tJsonAllocator *Allocator);
+
+
+#endif
@@ -0,0 +1,143 @@
+#include "json_scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define JSON_SCAN_X86
+#include <immintrin.h>
+#endif
+
+
+typedef enum
+{
+	json_ScanString,
+	json_ScanComment,
+	json_ScanWhitespace
+} tJsonScanType;
+
+
+static inline int JsonScanIsStop(tJsonScanType Type, uint8_t Byte)
+{
+	switch (Type)
+	{
+		case json_ScanString:
+			return (Byte == '"') || (Byte == '\\') || (Byte < 0x20) || (Byte >= 0x80);
+
+		case json_ScanComment:
+			return (Byte == '*') || (Byte < 0x20) || (Byte >= 0x80);
+
+		default:
+			return (Byte != ' ') && (Byte != '\t') && (Byte != '\r') && (Byte != '\n');
+	}
+}
+
+
+static inline size_t JsonScanScalar(tJsonScanType Type, const uint8_t *Content, size_t Length)
+{
+	size_t n;
+
+	for (n = 0; (n < Length) && !JsonScanIsStop(Type, Content[n]); n++)
+		;
+
+	return n;
+}
+
+
+#ifdef JSON_SCAN_X86
+static inline size_t JsonScanSse2(tJsonScanType Type, const uint8_t *Content, size_t Length)
+{
+	__m128i Block;
+	unsigned int Mask;
+	size_t n;
+
+	for (n = 0; n + sizeof(__m128i) <= Length; n = n + sizeof(__m128i))
+	{
+		Block = _mm_loadu_si128((const __m128i *)&Content[n]);
+		switch (Type)
+		{
+			case json_ScanString:
+				Mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(Block, _mm_set1_epi8('\\'))), _mm_cmplt_epi8(Block, _mm_set1_epi8(0x20))));
+			break;
+
+			case json_ScanComment:
+				Mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8('*')), _mm_cmplt_epi8(Block, _mm_set1_epi8(0x20))));
+			break;
+
+			default:
+				Mask = 0xFFFF ^ _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(Block, _mm_set1_epi8('\t'))), _mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(Block, _mm_set1_epi8('\n')))));
+			break;
+		}
+		if (Mask != 0)
+		{
+			return n + __builtin_ctz(Mask);
+		}
+	}
+
+	return n + JsonScanScalar(Type, &Content[n], Length - n);
+}
+
+
+__attribute__((target("avx2")))
+static size_t JsonScanAvx2(tJsonScanType Type, const uint8_t *Content, size_t Length)
+{
+	__m256i Block;
+	unsigned int Mask;
+	size_t n;
+
+	for (n = 0; n + sizeof(__m256i) <= Length; n = n + sizeof(__m256i))
+	{
+		Block = _mm256_loadu_si256((const __m256i *)&Content[n]);
+		switch (Type)
+		{
+			case json_ScanString:
+				Mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(Block, _mm256_set1_epi8('\\'))), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), Block)));
+			break;
+
+			case json_ScanComment:
+				Mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8('*')), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), Block)));
+			break;
+
+			default:
+				Mask = ~(unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(Block, _mm256_set1_epi8('\t'))), _mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(Block, _mm256_set1_epi8('\n')))));
+			break;
+		}
+		if (Mask != 0)
+		{
+			return n + __builtin_ctz(Mask);
+		}
+	}
+
+	return n + JsonScanSse2(Type, &Content[n], Length - n);
+}
+#endif
+
+
+static size_t JsonScan(tJsonScanType Type, const uint8_t *Content, size_t Length)
+{
+#ifdef JSON_SCAN_X86
+	if (Length >= sizeof(__m256i) && __builtin_cpu_supports("avx2"))
+	{
+		return JsonScanAvx2(Type, Content, Length);
+	}
+
+	return JsonScanSse2(Type, Content, Length);
+#else
+	return JsonScanScalar(Type, Content, Length);
+#endif
+}
+
+
+size_t JsonScanString(const uint8_t *Content, size_t Length)
+{
+	return JsonScan(json_ScanString, Content, Length);
+}
+
+
+size_t JsonScanComment(const uint8_t *Content, size_t Length)
+{
+	return JsonScan(json_ScanComment, Content, Length);
+}
+
+
+size_t JsonScanWhitespace(const uint8_t *Content, size_t Length)
+{
+	return JsonScan(json_ScanWhitespace, Content, Length);
+}
@@ -0,0 +1,41 @@
+#ifndef JSON_SCAN_H
+#define JSON_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Scans content for the end of a run of plain string characters
+ * @param Content The content to scan
+ * @param Length  The length of the content
+ * @return The offset to the first quotation mark, reverse solidus, control character or non-ASCII byte in the content.
+ * @return The value of \a `Length` is returned if there are no such bytes in the content.
+ * @note The content is scanned in blocks of 16 or 32 bytes when SSE2 or AVX2 instructions are available (this is determined at run time).
+ */
+size_t JsonScanString(const uint8_t *Content, size_t Length);
+
+
+/**
+ * @brief Scans content for the end of a run of plain comment characters
+ * @param Content The content to scan
+ * @param Length  The length of the content
+ * @return The offset to the first asterisk, control character or non-ASCII byte in the content.
+ * @return The value of \a `Length` is returned if there are no such bytes in the content.
+ * @note The content is scanned in blocks of 16 or 32 bytes when SSE2 or AVX2 instructions are available (this is determined at run time).
+ */
+size_t JsonScanComment(const uint8_t *Content, size_t Length);
+
+
+/**
+ * @brief Scans content for the end of a run of whitespace characters
+ * @param Content The content to scan
+ * @param Length  The length of the content
+ * @return The offset to the first byte in the content that is not a space, tab, carriage return or line feed.
+ * @return The value of \a `Length` is returned if the content is all whitespace.
+ * @note The content is scanned in blocks of 16 or 32 bytes when SSE2 or AVX2 instructions are available (this is determined at run time).
+ */
+size_t JsonScanWhitespace(const uint8_t *Content, size_t Length);
+
+
+#endif
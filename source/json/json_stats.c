@@ -0,0 +1,109 @@
+#include <string.h>
+#include "json_stats.h"
+
+#ifdef JSON_STATS
+#include <stdatomic.h>
+#include <time.h>
+
+
+static atomic_size_t JsonStatsMallocCount[json_StatsSubsystemCount];
+static atomic_size_t JsonStatsReallocCount[json_StatsSubsystemCount];
+static atomic_size_t JsonStatsFreeCount[json_StatsSubsystemCount];
+static atomic_size_t JsonStatsBytes[json_StatsSubsystemCount];
+static atomic_size_t JsonStatsCalls[json_StatsOperationCount];
+static _Atomic uint64_t JsonStatsNanoseconds[json_StatsOperationCount];
+
+
+void *JsonStatsMalloc(tJsonStatsSubsystem Subsystem, size_t Size)
+{
+	atomic_fetch_add_explicit(&JsonStatsMallocCount[Subsystem], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&JsonStatsBytes[Subsystem], Size, memory_order_relaxed);
+
+	return malloc(Size);
+}
+
+
+void *JsonStatsRealloc(tJsonStatsSubsystem Subsystem, void *Memory, size_t Size)
+{
+	atomic_fetch_add_explicit(&JsonStatsReallocCount[Subsystem], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&JsonStatsBytes[Subsystem], Size, memory_order_relaxed);
+
+	return realloc(Memory, Size);
+}
+
+
+void JsonStatsFree(tJsonStatsSubsystem Subsystem, void *Memory)
+{
+	if (Memory != NULL)
+	{
+		atomic_fetch_add_explicit(&JsonStatsFreeCount[Subsystem], 1, memory_order_relaxed);
+		free(Memory);
+	}
+}
+
+
+uint64_t JsonStatsGetTime(void)
+{
+	struct timespec Time;
+
+	if (timespec_get(&Time, TIME_UTC) == 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)Time.tv_sec * 1000000000u + (uint64_t)Time.tv_nsec;
+}
+
+
+void JsonStatsAddTime(tJsonStatsOperation Operation, uint64_t Start)
+{
+	atomic_fetch_add_explicit(&JsonStatsCalls[Operation], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&JsonStatsNanoseconds[Operation], JsonStatsGetTime() - Start, memory_order_relaxed);
+}
+#endif
+
+
+void JsonStatsGet(tJsonStats *Stats)
+{
+#ifdef JSON_STATS
+	size_t n;
+
+	for (n = 0; n < json_StatsSubsystemCount; n++)
+	{
+		Stats->Allocation[n].Malloc = atomic_load_explicit(&JsonStatsMallocCount[n], memory_order_relaxed);
+		Stats->Allocation[n].Realloc = atomic_load_explicit(&JsonStatsReallocCount[n], memory_order_relaxed);
+		Stats->Allocation[n].Free = atomic_load_explicit(&JsonStatsFreeCount[n], memory_order_relaxed);
+		Stats->Allocation[n].Bytes = atomic_load_explicit(&JsonStatsBytes[n], memory_order_relaxed);
+	}
+
+	for (n = 0; n < json_StatsOperationCount; n++)
+	{
+		Stats->Time[n].Calls = atomic_load_explicit(&JsonStatsCalls[n], memory_order_relaxed);
+		Stats->Time[n].Nanoseconds = atomic_load_explicit(&JsonStatsNanoseconds[n], memory_order_relaxed);
+	}
+#else
+	memset(Stats, 0, sizeof(*Stats));
+#endif
+}
+
+
+void JsonStatsReset(void)
+{
+#ifdef JSON_STATS
+	size_t n;
+
+	for (n = 0; n < json_StatsSubsystemCount; n++)
+	{
+		atomic_store_explicit(&JsonStatsMallocCount[n], 0, memory_order_relaxed);
+		atomic_store_explicit(&JsonStatsReallocCount[n], 0, memory_order_relaxed);
+		atomic_store_explicit(&JsonStatsFreeCount[n], 0, memory_order_relaxed);
+		atomic_store_explicit(&JsonStatsBytes[n], 0, memory_order_relaxed);
+	}
+
+	for (n = 0; n < json_StatsOperationCount; n++)
+	{
+		atomic_store_explicit(&JsonStatsCalls[n], 0, memory_order_relaxed);
+		atomic_store_explicit(&JsonStatsNanoseconds[n], 0, memory_order_relaxed);
+	}
+#endif
+}
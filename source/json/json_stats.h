@@ -0,0 +1,127 @@
+#ifndef JSON_STATS_H
+#define JSON_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/**
+ * @brief Enumeration used to define the library subsystems that allocate memory
+ */
+typedef enum
+{
+	json_StatsElement,      /**< Elements and object key indexes */
+	json_StatsString,       /**< Element names */
+	json_StatsPath,         /**< Compiled paths */
+	json_StatsArena,        /**< Arena chunks */
+	json_StatsTape,         /**< Tape entries and strings */
+	json_StatsRecycle,      /**< Recycled memory blocks */
+	json_StatsFilter,       /**< Filter frames and path tails */
+	json_StatsRecord,       /**< Record batches */
+	json_StatsSubsystemCount
+} tJsonStatsSubsystem;
+
+
+/**
+ * @brief Enumeration used to define the library operations that are timed
+ */
+typedef enum
+{
+	json_StatsParse,        /**< \a `JsonParse()` and \a `JsonParseUtf8()` */
+	json_StatsFormat,       /**< \a `JsonFormat()` and \a `JsonFormatUtf8()` */
+	json_StatsFind,         /**< \a `JsonElementFind()` and \a `JsonElementFindCompiled()` */
+	json_StatsOperationCount
+} tJsonStatsOperation;
+
+
+/**
+ * @brief Type used for the memory allocation statistics of a subsystem
+ */
+typedef struct
+{
+	size_t Malloc;  /**< The number of memory allocations */
+	size_t Realloc; /**< The number of memory reallocations */
+	size_t Free;    /**< The number of memory blocks that were freed */
+	size_t Bytes;   /**< The total number of bytes that were requested by the allocations and reallocations */
+} tJsonStatsAllocation;
+
+
+/**
+ * @brief Type used for the timing statistics of an operation
+ */
+typedef struct
+{
+	size_t   Calls;       /**< The number of calls */
+	uint64_t Nanoseconds; /**< The total time spent in the calls (in nanoseconds) */
+} tJsonStatsTime;
+
+
+/**
+ * @brief Type used for the library statistics
+ */
+typedef struct
+{
+	tJsonStatsAllocation Allocation[json_StatsSubsystemCount]; /**< The memory allocation statistics of each subsystem */
+	tJsonStatsTime       Time[json_StatsOperationCount];       /**< The timing statistics of each operation */
+} tJsonStats;
+
+
+#ifdef JSON_STATS
+void *JsonStatsMalloc(tJsonStatsSubsystem Subsystem, size_t Size);
+void *JsonStatsRealloc(tJsonStatsSubsystem Subsystem, void *Memory, size_t Size);
+void JsonStatsFree(tJsonStatsSubsystem Subsystem, void *Memory);
+uint64_t JsonStatsGetTime(void);
+void JsonStatsAddTime(tJsonStatsOperation Operation, uint64_t Start);
+
+#define JSON_STATS_MALLOC(Subsystem, Size)          JsonStatsMalloc(Subsystem, Size)
+#define JSON_STATS_REALLOC(Subsystem, Memory, Size) JsonStatsRealloc(Subsystem, Memory, Size)
+#define JSON_STATS_FREE(Subsystem, Memory)          JsonStatsFree(Subsystem, Memory)
+#define JSON_STATS_TIMER(Timer)                     uint64_t Timer = JsonStatsGetTime()
+#define JSON_STATS_TIME(Operation, Timer)           JsonStatsAddTime(Operation, Timer)
+#else
+/**
+ * @brief Allocates memory for a subsystem (and counts the allocation if the library is built with \a `JSON_STATS` defined)
+ */
+#define JSON_STATS_MALLOC(Subsystem, Size)          malloc(Size)
+
+/**
+ * @brief Reallocates memory for a subsystem (and counts the reallocation if the library is built with \a `JSON_STATS` defined)
+ */
+#define JSON_STATS_REALLOC(Subsystem, Memory, Size) realloc(Memory, Size)
+
+/**
+ * @brief Frees memory for a subsystem (and counts the free if the library is built with \a `JSON_STATS` defined)
+ */
+#define JSON_STATS_FREE(Subsystem, Memory)          free(Memory)
+
+/**
+ * @brief Declares a timer that is started at the start of an operation (if the library is built with \a `JSON_STATS` defined)
+ */
+#define JSON_STATS_TIMER(Timer)
+
+/**
+ * @brief Adds the time since a timer was started to the statistics of an operation (if the library is built with \a `JSON_STATS` defined)
+ */
+#define JSON_STATS_TIME(Operation, Timer)           ((void)0)
+#endif
+
+
+/**
+ * @brief Gets the library statistics
+ * @param Stats Updated with the statistics
+ * @return None
+ * @note The statistics are only collected if the library is built with \a `JSON_STATS` defined (use 'make STATS=1') - otherwise they are all zero.
+ * @note The statistics are collected for all threads.
+ */
+void JsonStatsGet(tJsonStats *Stats);
+
+
+/**
+ * @brief Resets the library statistics (to zero)
+ * @return None
+ */
+void JsonStatsReset(void);
+
+
+#endif
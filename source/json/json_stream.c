@@ -0,0 +1,533 @@
+#include <string.h>
+#include "json_stream.h"
+
+
+/**
+ * @brief Enumeration used to define what is required before an edit can be applied (see \a `JsonStreamResolveEdit()`)
+ */
+typedef enum
+{
+	json_StreamEditWait,  /**< The edit cannot be applied until more content has been parsed */
+	json_StreamEditHold,  /**< The edit cannot be applied until an element has been completely parsed (the element must not be formatted yet) */
+	json_StreamEditApply  /**< The edit can be applied */
+} tJsonStreamEdit;
+
+
+static bool JsonStreamIsNameComplete(const tJsonStream *Stream, const tJsonElement *Element)
+{
+	return JsonParseIsNameComplete(&Stream->Parse, Element);
+}
+
+
+static bool JsonStreamIsComplete(const tJsonStream *Stream, const tJsonElement *Element)
+{
+	return (Stream->ParseState == JSON_PARSE_COMPLETE) || JsonParseIsComplete(&Stream->Parse, Element);
+}
+
+
+static bool JsonStreamIsAncestor(const tJsonElement *Ancestor, const tJsonElement *Element)
+{
+	for (; Element != NULL; Element = Element->Parent)
+	{
+		if (Element == Ancestor)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+static bool JsonStreamIsHeld(const tJsonStream *Stream, const tJsonElement *Element)
+{
+	size_t n;
+
+	for (n = 0; n < Stream->EditCount; n++)
+	{
+		if (Stream->Edit[n].Hold == Element)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+static bool JsonStreamIsNextDecided(const tJsonStream *Stream, tJsonElement *Element, bool IgnoreComments)
+{
+	return (JsonElementGetNext(Element, IgnoreComments) != NULL) || JsonStreamIsComplete(Stream, Element->Parent);
+}
+
+
+static bool JsonStreamIsStartReady(const tJsonStream *Stream, tJsonElement *Element)
+{
+	if (JsonStreamIsHeld(Stream, Element))
+	{
+		return false;
+	}
+	else if ((Element->Type == json_TypeObject) || (Element->Type == json_TypeArray))
+	{
+		return (JsonElementGetChild(Element, Stream->Format.CommentType == json_CommentNone) != NULL) || JsonStreamIsComplete(Stream, Element);
+	}
+
+	return JsonStreamIsNameComplete(Stream, Element);
+}
+
+
+static bool JsonStreamIsNextReady(const tJsonStream *Stream, tJsonElement *Element)
+{
+	tJsonElement *Next;
+	tJsonType Type;
+
+	for (Type = Element->Type; Element->Parent != NULL; Element = Element->Parent)
+	{
+		Next = JsonElementGetNext(Element, Stream->Format.CommentType == json_CommentNone);
+		if (Next != NULL)
+		{
+			if ((Type != json_TypeComment) && (Type != json_TypeKey) && !JsonStreamIsNextDecided(Stream, (Element->Parent->Type == json_TypeKey) ? Element->Parent : Element, true))
+			{
+				return false;
+			}
+			return JsonStreamIsStartReady(Stream, Next);
+		}
+		else if (!JsonStreamIsComplete(Stream, Element->Parent))
+		{
+			return false;
+		}
+		else if (Element->Parent->Type != json_TypeKey)
+		{
+			break;
+		}
+		else if ((Type != json_TypeComment) && !JsonStreamIsNextDecided(Stream, Element->Parent, true))
+		{
+			return false;
+		}
+		Type = json_TypeKey;
+	}
+
+	return true;
+}
+
+
+static bool JsonStreamIsCommentReady(const tJsonStream *Stream, tJsonElement *Element)
+{
+	if (!JsonStreamIsNameComplete(Stream, Element))
+	{
+		return false;
+	}
+	else if (Stream->Format.CommentType != json_CommentBlock)
+	{
+		return JsonStreamIsNextReady(Stream, Element);
+	}
+	else if (Element->Next != NULL)
+	{
+		return (Element->Next->Type != json_TypeComment) || JsonStreamIsNameComplete(Stream, Element->Next);
+	}
+
+	return JsonStreamIsComplete(Stream, Element->Parent);
+}
+
+
+static bool JsonStreamIsReady(const tJsonStream *Stream)
+{
+	const tJsonFormat *Format = &Stream->Format;
+	tJsonElement *Element = Format->Element;
+	bool IsReady = true;
+
+	if (Element != NULL)
+	{
+		switch (Format->State)
+		{
+			case json_FormatKey:
+			case json_FormatValueString:
+				IsReady = JsonStreamIsNameComplete(Stream, Element);
+			break;
+
+			case json_FormatValueLiteral:
+				IsReady = JsonStreamIsNameComplete(Stream, Element) && JsonStreamIsNextReady(Stream, Element);
+			break;
+
+			case json_FormatKeyEnd:
+				IsReady = (JsonElementGetChild(Element, Format->CommentType == json_CommentNone) != NULL);
+			break;
+
+			case json_FormatValueStart:
+				IsReady = Format->NewLine || (Format->SpaceCount != 0) || JsonStreamIsStartReady(Stream, Element);
+			break;
+
+			case json_FormatValueNext:
+				IsReady = JsonStreamIsNextReady(Stream, Element);
+			break;
+
+			case json_FormatComment:
+				IsReady = (Format->SpaceCount != 0) || JsonStreamIsCommentReady(Stream, Element);
+			break;
+
+			default:
+			break;
+		}
+	}
+
+	return IsReady;
+}
+
+
+static tJsonElement *JsonStreamFindKey(const tJsonStream *Stream, tJsonElement *Element, tJsonPath Component, bool *IsComplete)
+{
+	tJsonString Name;
+	bool IsEscaped;
+	bool ok = true;
+
+	IsEscaped = (Component.Length != 0) && (memchr(Component.Value, '\\', Component.Length) != NULL);
+	if (IsEscaped)
+	{
+		JsonStringSetUp(&Name);
+		ok = JsonPathGetString(Component, &Name);
+	}
+
+	for (*IsComplete = true; Element != NULL; Element = JsonElementGetNext(Element, true))
+	{
+		if (!JsonStreamIsNameComplete(Stream, Element))
+		{
+			*IsComplete = false;
+			Element = NULL;
+			break;
+		}
+		else if (ok && !IsEscaped && JsonPathCompareString(Component, &Element->Name))
+		{
+			break;
+		}
+		else if (ok && IsEscaped && (Element->Name.Length == Name.Length) && ((Name.Length == 0) || (memcmp(Element->Name.Content, Name.Content, Name.Length) == 0)))
+		{
+			break;
+		}
+	}
+
+	if (IsEscaped)
+	{
+		JsonStringCleanUp(&Name);
+	}
+
+	return Element;
+}
+
+
+static tJsonStreamEdit JsonStreamResolveEdit(tJsonStream *Stream, const tJsonEdit *Edit, tJsonElement **Region)
+{
+	tJsonElement *Parent = &Stream->Root;
+	tJsonElement *Element;
+	tJsonPath Path = Edit->Path;
+	tJsonPath Component;
+	tJsonType ComponentType;
+	size_t Length;
+	bool IsComplete;
+
+	for (;;)
+	{
+		*Region = Parent;
+		Element = JsonElementGetChild(Parent, true);
+		Length = JsonPathGetComponent(Path, &ComponentType, &Component);
+		if (Length == 0)
+		{
+			return json_StreamEditApply;
+		}
+		else if (Element == NULL)
+		{
+			return JsonStreamIsComplete(Stream, Parent) ? json_StreamEditApply : json_StreamEditWait;
+		}
+		else if (ComponentType != Element->Type)
+		{
+			*Region = Element;
+			return json_StreamEditApply;
+		}
+		else if (ComponentType == json_TypeKey)
+		{
+			Element = JsonStreamFindKey(Stream, Element, Component, &IsComplete);
+			if (Element == NULL)
+			{
+				return (IsComplete && JsonStreamIsComplete(Stream, Parent)) ? json_StreamEditApply : json_StreamEditWait;
+			}
+		}
+		else if (ComponentType != json_TypeObject)
+		{
+			*Region = Element;
+			return JsonStreamIsComplete(Stream, Element) ? json_StreamEditApply : json_StreamEditHold;
+		}
+
+		Path = JsonPathRight(Path, Length);
+		if (Path.Length == 0)
+		{
+			*Region = Element;
+			return JsonStreamIsComplete(Stream, Element) ? json_StreamEditApply : json_StreamEditHold;
+		}
+		Parent = Element;
+	}
+}
+
+
+static bool JsonStreamIsBlocked(const tJsonStream *Stream, size_t EditCount, const tJsonElement *Region)
+{
+	const tJsonEdit *Edit;
+	size_t n;
+
+	for (n = 0; n < EditCount; n++)
+	{
+		Edit = &Stream->Edit[n];
+		if ((Edit->Hold != NULL) && (JsonStreamIsAncestor(Edit->Hold, Region) || JsonStreamIsAncestor(Region, Edit->Hold)))
+		{
+			return true;
+		}
+		else if ((Edit->Wait != NULL) && JsonStreamIsAncestor(Region, Edit->Wait))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+static bool JsonStreamIsPending(const tJsonStream *Stream)
+{
+	size_t n;
+
+	for (n = 0; n < Stream->EditError; n++)
+	{
+		if (Stream->Edit[n].State == json_EditPending)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+static tJsonEditState JsonStreamApplyEdit(tJsonStream *Stream, tJsonEdit *Edit)
+{
+	tJsonElement *Element;
+	tJsonElement *Value;
+
+	Element = JsonElementFind(&Stream->Root, Edit->Path, true);
+	if (Element == NULL)
+	{
+		return json_EditNoPath;
+	}
+	else if (Edit->Value == NULL)
+	{
+		return json_EditNoValue;
+	}
+
+	Value = JsonElementGetChild(Edit->Value, true);
+	if ((JsonElementGetType(Element) == json_TypeObject) && (Value != NULL) && (JsonElementGetType(Value) == json_TypeObject))
+	{
+		return (JsonElementMoveChild(Element, Value) != NULL) ? json_EditApplied : json_EditNoValue;
+	}
+
+	return (JsonElementMoveChild(Element, Edit->Value) != NULL) ? json_EditApplied : json_EditNoValue;
+}
+
+
+static void JsonStreamEdit(tJsonStream *Stream)
+{
+	tJsonElement *Region;
+	tJsonEdit *Edit;
+	size_t n;
+
+	for (n = 0; n < Stream->EditError; n++)
+	{
+		Edit = &Stream->Edit[n];
+		Edit->Hold = NULL;
+		Edit->Wait = NULL;
+		if (Edit->State != json_EditPending)
+		{
+			continue;
+		}
+
+		switch (JsonStreamResolveEdit(Stream, Edit, &Region))
+		{
+			case json_StreamEditWait:
+				Edit->Wait = Region;
+			break;
+
+			case json_StreamEditHold:
+				Edit->Hold = Region;
+			break;
+
+			case json_StreamEditApply:
+				if (JsonStreamIsBlocked(Stream, n, Region))
+				{
+					Edit->Hold = Region;
+				}
+				else
+				{
+					Edit->State = JsonStreamApplyEdit(Stream, Edit);
+					if (Edit->State != json_EditApplied)
+					{
+						Stream->EditError = n;
+					}
+				}
+			break;
+		}
+	}
+}
+
+
+static void JsonStreamFree(tJsonElement *Element)
+{
+	for (; Element != NULL; Element = Element->Parent)
+	{
+		JsonElementFreePrevious(Element);
+	}
+}
+
+
+void JsonEditSetUp(tJsonEdit *Edit, tJsonPath Path, tJsonElement *Value)
+{
+	Edit->Path = Path;
+	Edit->Value = Value;
+	Edit->Hold = NULL;
+	Edit->Wait = NULL;
+	Edit->State = json_EditPending;
+}
+
+
+void JsonStreamSetUp(tJsonStream *Stream, size_t IndentSize, tJsonCommentType CommentType, tJsonEdit *Edit, size_t EditCount)
+{
+	JsonElementSetUp(&Stream->Root);
+	Stream->Edit = Edit;
+	Stream->EditCount = (Edit != NULL) ? EditCount : 0;
+	Stream->EditError = Stream->EditCount;
+	Stream->IndentSize = IndentSize;
+	Stream->CommentType = (IndentSize == 0) ? json_CommentNone : CommentType;
+	Stream->ParseState = JSON_PARSE_INCOMPLETE;
+	Stream->Formatting = false;
+	JsonParseSetUp(&Stream->Parse, CommentType == json_CommentNone, &Stream->Root);
+	JsonFormatCleanUp(&Stream->Format);
+}
+
+
+void JsonStreamCleanUp(tJsonStream *Stream)
+{
+	JsonFormatCleanUp(&Stream->Format);
+	JsonParseCleanUp(&Stream->Parse);
+	JsonElementCleanUp(&Stream->Root);
+	Stream->Edit = NULL;
+	Stream->EditCount = 0;
+	Stream->EditError = 0;
+	Stream->IndentSize = 0;
+	Stream->CommentType = json_CommentNone;
+	Stream->ParseState = JSON_PARSE_COMPLETE;
+	Stream->Formatting = false;
+}
+
+
+int JsonStreamParse(tJsonStream *Stream, tJsonUtfType UtfType, const uint8_t *Content, size_t Length, size_t *Offset)
+{
+	if (Stream->ParseState == JSON_PARSE_INCOMPLETE)
+	{
+		Stream->ParseState = JsonParse(&Stream->Parse, UtfType, Content, Length, Offset);
+		if (Stream->ParseState != JSON_PARSE_ERROR)
+		{
+			JsonStreamEdit(Stream);
+		}
+		if ((Stream->EditError < Stream->EditCount) && !JsonStreamIsPending(Stream))
+		{
+			JsonStreamFree(Stream->Parse.Element);
+		}
+	}
+
+	if (Stream->ParseState == JSON_PARSE_ERROR)
+	{
+		return JSON_STREAM_ERROR;
+	}
+	else if (Stream->ParseState == JSON_PARSE_COMPLETE)
+	{
+		return (Stream->EditError < Stream->EditCount) ? JSON_STREAM_ERROR : JSON_STREAM_COMPLETE;
+	}
+	else
+	{
+		return JSON_STREAM_INCOMPLETE;
+	}
+}
+
+
+int JsonStreamFormat(tJsonStream *Stream, tJsonUtfType UtfType, uint8_t *Content, size_t Size, size_t *Offset)
+{
+	tJsonFormat *Format = &Stream->Format;
+	tJsonElement *Element = NULL;
+	tJsonFormatState FormatState = json_FormatError;
+	tJsonCharacter Character;
+	size_t DiscardOffset = 0;
+	size_t Length;
+	int State = JSON_FORMAT_INCOMPLETE;
+
+	if ((Size < JSON_FORMAT_MIN_SIZE) || (Stream->ParseState == JSON_PARSE_ERROR) || (Stream->EditError < Stream->EditCount))
+	{
+		return JSON_STREAM_ERROR;
+	}
+
+	if (Offset == NULL)
+	{
+		Offset = &DiscardOffset;
+	}
+
+	if (!Stream->Formatting)
+	{
+		if ((JsonElementGetChild(&Stream->Root, Stream->CommentType == json_CommentNone) == NULL) && (Stream->ParseState != JSON_PARSE_COMPLETE))
+		{
+			return JSON_STREAM_WAITING;
+		}
+		else if (Stream->IndentSize == 0)
+		{
+			JsonFormatSetUpSpace(Format, &Stream->Root);
+		}
+		else
+		{
+			JsonFormatSetUpIndent(Format, Stream->IndentSize, Stream->CommentType, &Stream->Root);
+		}
+		Stream->Formatting = true;
+	}
+
+	while ((State == JSON_FORMAT_INCOMPLETE) && (*Offset <= Size - JSON_FORMAT_MIN_SIZE))
+	{
+		if ((Format->Element != Element) || (Format->State != FormatState) || (FormatState == json_FormatValueStart) || (FormatState == json_FormatComment))
+		{
+			if (!JsonStreamIsReady(Stream))
+			{
+				break;
+			}
+			Element = Format->Element;
+			FormatState = Format->State;
+		}
+
+		if ((UtfType == json_Utf8) && (Element != NULL) && ((Length = JsonFormatUtf8Span(Format, Content, Size, *Offset)) != 0))
+		{
+			*Offset = *Offset + Length;
+			continue;
+		}
+
+		State = JsonFormatCharacter(Format, &Character);
+		Length = (State == JSON_FORMAT_INCOMPLETE) ? JsonUtfEncode(UtfType, Content, Size, *Offset, Character) : 0;
+		if ((State == JSON_FORMAT_INCOMPLETE) && (Length == 0))
+		{
+			State = JSON_FORMAT_ERROR;
+		}
+		*Offset = *Offset + Length;
+	}
+
+	if (State == JSON_FORMAT_ERROR)
+	{
+		return JSON_STREAM_ERROR;
+	}
+	else if (State == JSON_FORMAT_COMPLETE)
+	{
+		return JSON_STREAM_COMPLETE;
+	}
+
+	JsonStreamFree(Format->Element);
+
+	return (*Offset <= Size - JSON_FORMAT_MIN_SIZE) ? JSON_STREAM_WAITING : JSON_STREAM_INCOMPLETE;
+}
@@ -0,0 +1,135 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include "json_format.h"
+#include "json_parse.h"
+
+
+/**
+ * @brief Enumeration used to define the different states of an edit
+ */
+typedef enum
+{
+	json_EditPending, /**< The edit has not been applied yet */
+	json_EditApplied, /**< The edit has been applied */
+	json_EditNoPath,  /**< The edit could not be applied because its path could not be found or created */
+	json_EditNoValue  /**< The edit could not be applied because its value could not be set at its path */
+} tJsonEditState;
+
+
+/**
+ * @brief Type used for an edit that sets the value of an element while JSON content is streamed
+ */
+typedef struct
+{
+	tJsonPath      Path;  /**< The path of the element to set (the element is created if it is not found - see \a `JsonElementFind()`) */
+	tJsonElement  *Value; /**< The root element of the value to set (its children are moved to the element when the edit is applied) - or \a `NULL` if there is no valid value */
+	tJsonElement  *Hold;  /**< The element that must not be formatted until the edit has been applied (or \a `NULL`) */
+	tJsonElement  *Wait;  /**< The element that must be parsed further before the edit can be applied (or \a `NULL`) */
+	tJsonEditState State; /**< The state of the edit */
+} tJsonEdit;
+
+
+/**
+ * @brief Type used for streaming JSON content from a parser to a formatter (applying any edits on the way)
+ * @note Only the elements that have been parsed but not yet formatted are kept, so the memory used depends on the nesting depth of the content - not its size.
+ * @note The exception is an element that is targeted by an edit - it is kept (and not formatted) until it has been completely parsed and the edit has been applied.
+ * @note An edit is not applied while an earlier edit that could change the same elements is still pending, so the edits give the same result as when they are applied in order.
+ */
+typedef struct
+{
+	tJsonElement     Root;        /**< The root of the elements that have been parsed but not yet formatted */
+	tJsonParse       Parse;       /**< The parser */
+	tJsonFormat      Format;      /**< The formatter (set up once the first element has been parsed) */
+	tJsonEdit       *Edit;        /**< The edits to apply */
+	size_t           EditCount;   /**< The number of edits */
+	size_t           EditError;   /**< The index of the first edit that could not be applied (or \a `EditCount` if there is none) */
+	size_t           IndentSize;  /**< The number of spaces to use for each indentation (zero for a spaced format) */
+	tJsonCommentType CommentType; /**< Indicates how to format any comments */
+	int              ParseState;  /**< The state of the parser (see \a `JsonParse()`) */
+	bool             Formatting;  /**< Indicates whether the formatter has been set up */
+} tJsonStream;
+
+
+/**
+ * @name JsonStream return codes
+ * @{
+ */
+#define JSON_STREAM_ERROR      -1 /**< A parsing, formatting or edit error occurred */
+#define JSON_STREAM_COMPLETE   0  /**< Parsing (or formatting) is complete */
+#define JSON_STREAM_INCOMPLETE 1  /**< Parsing is incomplete (or the formatted content is full) */
+#define JSON_STREAM_WAITING    2  /**< Formatting is waiting for more JSON content to be parsed */
+/** @} */
+
+
+/**
+ * @brief Sets up an edit
+ * @param Edit  The edit to set up
+ * @param Path  The path of the element to set
+ * @param Value The root element of the value to set (or \a `NULL` if there is no valid value)
+ * @return None
+ * @note If the value is \a `NULL` then the edit fails with \a `json_EditNoValue` once its path has been found (or created).
+ * @note If both the element and the value are objects then the keys of the element are replaced - otherwise the children of the element are replaced (the same as using \a `JsonElementMoveChild()`).
+ * @note The path and the value must remain valid until the edit has been applied.
+ */
+void JsonEditSetUp(tJsonEdit *Edit, tJsonPath Path, tJsonElement *Value);
+
+
+/**
+ * @brief Sets up a JSON content stream
+ * @param Stream      The JSON content stream to set up
+ * @param IndentSize  The number of spaces to use for each indentation (zero for a spaced format)
+ * @param CommentType Indicates how to format any comments (ignored for a spaced format)
+ * @param Edit        The edits to apply to the JSON content (in order)
+ * @param EditCount   The number of edits
+ * @return None
+ * @note The formatted content is the same as \a `JsonWriteFile()` gives for the parsed content after the edits have been applied in order.
+ * @note Use \a `JsonStreamCleanUp()` to clean up the stream when it is no longer required
+ */
+void JsonStreamSetUp(tJsonStream *Stream, size_t IndentSize, tJsonCommentType CommentType, tJsonEdit *Edit, size_t EditCount);
+
+
+/**
+ * @brief Cleans up a JSON content stream
+ * @param Stream The JSON content stream to clean up
+ * @return None
+ */
+void JsonStreamCleanUp(tJsonStream *Stream);
+
+
+/**
+ * @brief Parses JSON content into a stream (and applies any edits that can be applied)
+ * @param Stream  The JSON content stream
+ * @param UtfType The type of UTF to use to decode the content
+ * @param Content The JSON content
+ * @param Length  The length of the JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is parsed
+ * @return `JSON_STREAM_ERROR`      is returned if there was a parsing error (or the parsing is complete and an edit could not be applied - see \a `tJsonStream.EditError`).
+ * @return `JSON_STREAM_COMPLETE`   is returned if the parsing is complete.
+ * @return `JSON_STREAM_INCOMPLETE` is returned if parsing is not yet complete.
+ * @note The parsing should be completed by parsing an encoded null character.
+ * @note If an edit cannot be applied then the parsing continues (without keeping the parsed content) until any earlier edits have been applied and the content is complete - a parsing error takes precedence over an edit error, and an earlier edit error takes precedence over a later one.
+ * @note Use \a `JsonStreamFormat()` after each call to format the parsed content (and free it).
+ */
+int JsonStreamParse(tJsonStream *Stream, tJsonUtfType UtfType, const uint8_t *Content, size_t Length, size_t *Offset);
+
+
+/**
+ * @brief Formats the JSON content that has been parsed into a stream
+ * @param Stream  The JSON content stream
+ * @param UtfType The type of UTF to use to encode the content
+ * @param Content Used to return the encoded JSON content
+ * @param Size    The size of the encoded JSON content
+ * @param Offset  Used to pass and return the offset where the JSON content is formatted
+ * @return `JSON_STREAM_ERROR`      is returned if there was a parsing, formatting or edit error.
+ * @return `JSON_STREAM_COMPLETE`   is returned if the formatting is complete.
+ * @return `JSON_STREAM_INCOMPLETE` is returned if the encoded JSON content is full (use the content and call the function again).
+ * @return `JSON_STREAM_WAITING`    is returned if more JSON content must be parsed before formatting can continue.
+ * @note The \a `Content` size should be at least \a `JSON_FORMAT_MIN_SIZE` in bytes
+ * @note The formatter never gets ahead of the parser - an element is only formatted once it is known how it (and the punctuation after it) is formatted.
+ * @note The elements that have been formatted are freed.
+ */
+int JsonStreamFormat(tJsonStream *Stream, tJsonUtfType UtfType, uint8_t *Content, size_t Size, size_t *Offset);
+
+
+#endif
@@ -3,44 +3,76 @@
 #include "json_string.h"
 
 
-#define JSON_STRING_SENTINEL       0xFF
-#define JSON_STRING_INITIAL_LENGTH 32
+static bool JsonStringIsAllocated(const tJsonString *String)
+{
+	return (String->Capacity != 0) && (String->Content != String->Inline);
+}
 
 
-static bool JsonStringAddByte(tJsonString *String, uint8_t Byte)
+static bool JsonStringResize(tJsonString *String, size_t Capacity)
 {
 	uint8_t *NewContent;
-	size_t NewLength;
 
-	if (Byte == '\0')
+	if (Capacity <= JSON_STRING_INLINE_LENGTH)
 	{
-		return false;
+		NewContent = String->Inline;
+		Capacity = JSON_STRING_INLINE_LENGTH;
+		if ((String->Content != NULL) && (String->Content != NewContent))
+		{
+			memcpy(NewContent, String->Content, String->Length);
+			if (JsonStringIsAllocated(String))
+			{
+				JsonAllocatorFree(String->Allocator, json_StatsString, String->Content, String->Capacity + 1);
+			}
+		}
 	}
-
-	if ((String->Content == NULL) || (String->Content[String->Length + 1] == JSON_STRING_SENTINEL))
+	else if ((String->Content == NULL) || (String->Content == String->Inline) || JsonStringIsView(String))
 	{
-		NewLength = 2 + ((String->Content == NULL) ? JSON_STRING_INITIAL_LENGTH : String->Length + String->Length / 2);
-		if (NewLength < String->Length)
+		NewContent = (uint8_t *)JsonAllocatorAllocate(String->Allocator, json_StatsString, Capacity + 1);
+		if ((NewContent != NULL) && (String->Content != NULL))
 		{
-			return false;
+			memcpy(NewContent, String->Content, String->Length);
 		}
+	}
+	else
+	{
+		NewContent = (uint8_t *)JsonAllocatorReallocate(String->Allocator, json_StatsString, String->Content, String->Capacity + 1, Capacity + 1);
+	}
+	if (NewContent == NULL)
+	{
+		return false;
+	}
 
-		NewContent = (uint8_t *)realloc(String->Content, NewLength);
-		if (NewContent == NULL)
-		{
-			return false;
-		}
+	NewContent[String->Length] = '\0';
+
+	String->Content = NewContent;
+	String->Capacity = Capacity;
 
-		memset(&NewContent[String->Length + 1], 0, NewLength - String->Length - 2);
-		NewContent[NewLength - 1] = JSON_STRING_SENTINEL;
+	return true;
+}
+
+
+static bool JsonStringGrow(tJsonString *String, size_t Length)
+{
+	size_t Capacity;
 
-		String->Content = NewContent;
+	if (Length > SIZE_MAX - String->Length - 1)
+	{
+		return false;
 	}
 
-	String->Content[String->Length] = Byte;
-	String->Length++;
+	if (String->Length + Length <= String->Capacity)
+	{
+		return true;
+	}
 
-	return true;
+	Capacity = (String->Content == NULL) ? JSON_STRING_INLINE_LENGTH : String->Capacity + String->Capacity / 2;
+	if ((Capacity < String->Length + Length) || (Capacity == SIZE_MAX))
+	{
+		Capacity = String->Length + Length;
+	}
+
+	return JsonStringResize(String, Capacity);
 }
 
 
@@ -48,6 +80,17 @@ void JsonStringSetUp(tJsonString *String)
 {
 	String->Content = NULL;
 	String->Length = 0;
+	String->Capacity = 0;
+	String->Allocator = NULL;
+}
+
+
+void JsonStringSetUpAllocator(tJsonString *String, const tJsonAllocator *Allocator)
+{
+	String->Content = NULL;
+	String->Length = 0;
+	String->Capacity = 0;
+	String->Allocator = Allocator;
 }
 
 
@@ -59,12 +102,13 @@ void JsonStringCleanUp(tJsonString *String)
 
 void JsonStringClear(tJsonString *String)
 {
-	if (String->Content != NULL)
+	if (JsonStringIsAllocated(String))
 	{
-		free(String->Content);
-		String->Content = NULL;
+		JsonAllocatorFree(String->Allocator, json_StatsString, String->Content, String->Capacity + 1);
 	}
+	String->Content = NULL;
 	String->Length = 0;
+	String->Capacity = 0;
 }
 
 
@@ -74,22 +118,104 @@ size_t JsonStringGetLength(const tJsonString *String)
 }
 
 
+size_t JsonStringGetCapacity(const tJsonString *String)
+{
+	return String->Capacity;
+}
+
+
+bool JsonStringReserve(tJsonString *String, size_t Capacity)
+{
+	if ((Capacity <= String->Capacity) || (Capacity == SIZE_MAX))
+	{
+		return Capacity <= String->Capacity;
+	}
+
+	return JsonStringResize(String, Capacity);
+}
+
+
+bool JsonStringShrinkToFit(tJsonString *String)
+{
+	if ((String->Length == String->Capacity) || JsonStringIsView(String))
+	{
+		return true;
+	}
+
+	if (String->Length == 0)
+	{
+		JsonStringClear(String);
+		return true;
+	}
+
+	if (!JsonAllocatorCanFree(String->Allocator) && (String->Length > JSON_STRING_INLINE_LENGTH))
+	{
+		return true;
+	}
+
+	return JsonStringResize(String, String->Length);
+}
+
+
 bool JsonStringAddCharacter(tJsonString *String, tJsonCharacter Character)
 {
 	tJsonUtf8 Utf8;
 	size_t Length;
-	size_t n;
 
 	Length = JsonUtf8Encode(Utf8, sizeof(Utf8), 0, Character);
+	if ((Character == '\0') || (Length == 0))
+	{
+		return false;
+	}
+
+	return JsonStringAddBytes(String, Utf8, Length);
+}
+
+
+bool JsonStringAddBytes(tJsonString *String, const uint8_t *Bytes, size_t Length)
+{
 	if (Length == 0)
+	{
+		return true;
+	}
+	else if (!JsonStringGrow(String, Length))
 	{
 		return false;
 	}
 
-	for (n = 0; (n < Length) && JsonStringAddByte(String, Utf8[n]); n++)
-		;
+	memcpy(&String->Content[String->Length], Bytes, Length);
+	String->Length = String->Length + Length;
+	String->Content[String->Length] = '\0';
 
-	return n == Length;
+	return true;
+}
+
+
+bool JsonStringAddView(tJsonString *String, const uint8_t *Bytes, size_t Length)
+{
+	if (Length == 0)
+	{
+		return true;
+	}
+	else if (String->Length == 0)
+	{
+		JsonStringClear(String);
+		String->Content = (uint8_t *)Bytes;
+	}
+	else if (!JsonStringIsView(String) || (&String->Content[String->Length] != Bytes))
+	{
+		return JsonStringAddBytes(String, Bytes, Length);
+	}
+
+	String->Length = String->Length + Length;
+
+	return true;
+}
+
+
+bool JsonStringIsView(const tJsonString *String)
+{
+	return (String->Content != NULL) && (String->Capacity == 0);
 }
 
 
@@ -97,3 +223,22 @@ size_t JsonStringGetNextCharacter(const tJsonString *String, size_t Offset, tJso
 {
 	return JsonUtf8DecodeNext(String->Content, String->Length, Offset, Character);
 }
+
+
+uint32_t JsonStringHashBytes(uint32_t Hash, const uint8_t *Bytes, size_t Length)
+{
+	size_t n;
+
+	for (n = 0; n < Length; n++)
+	{
+		Hash = (Hash ^ Bytes[n]) * 16777619u;
+	}
+
+	return Hash;
+}
+
+
+uint32_t JsonStringGetHash(const tJsonString *String)
+{
+	return JsonStringHashBytes(JSON_STRING_HASH_INITIAL, String->Content, String->Length);
+}
@@ -2,16 +2,28 @@
 #define JSON_STRING_H
 
 #include <stddef.h>
+#include "json_allocator.h"
 #include "json_utf8.h"
 
 
+/**
+ * @brief The maximum length of a string that can be held inline (without allocating any memory for its content)
+ */
+#define JSON_STRING_INLINE_LENGTH 15
+
+
 /**
  * @brief Type used to hold a string value
+ * @note A short string will point its content at its own inline storage - a string should therefore not be copied by value.
+ * @note A string can also be a view of some external content (see \a `JsonStringAddView()`) - the content of a view is not null terminated.
  */
 typedef struct
 {
-	uint8_t *Content;   /**< The content of the string (null terminated) */
-	size_t   Length;    /**< The length of the string */
+	uint8_t              *Content;                               /**< The content of the string (null terminated, unless the string is a view) */
+	size_t                Length;                                /**< The length of the string */
+	size_t                Capacity;                              /**< The maximum length that the string can have before its content needs to be reallocated (zero for a view) */
+	const tJsonAllocator *Allocator;                             /**< The allocator that the content is allocated from (or \a `NULL` if the content is allocated from the heap) */
+	uint8_t               Inline[JSON_STRING_INLINE_LENGTH + 1]; /**< The inline storage that is used for the content of a short string */
 } tJsonString;
 
 
@@ -24,6 +36,17 @@ typedef struct
 void JsonStringSetUp(tJsonString *String);
 
 
+/**
+ * @brief Sets up a string that allocates its content from an allocator
+ * @param String    The string to set up
+ * @param Allocator The allocator to allocate the string content from (or \a `NULL` for the heap)
+ * @return None
+ * @note The allocator must remain valid until the string is cleaned up
+ * @note Use \a `JsonStringCleanUp()` to clean up the string when it is no longer required
+ */
+void JsonStringSetUpAllocator(tJsonString *String, const tJsonAllocator *Allocator);
+
+
 /**
  * @brief Cleans up a string
  * @param String The string to clean up
@@ -48,16 +71,83 @@ void JsonStringClear(tJsonString *String);
 size_t JsonStringGetLength(const tJsonString *String);
 
 
+/**
+ * @brief Gets the capacity of a string
+ * @param String The string
+ * @return The maximum length that the string can have before its content needs to be reallocated
+ */
+size_t JsonStringGetCapacity(const tJsonString *String);
+
+
+/**
+ * @brief Reserves capacity in a string
+ * @param String   The string
+ * @param Capacity The minimum length that the string should be able to hold without reallocating its content
+ * @return A true value is returned if the capacity was reserved ok.
+ * @return A false value is returned if the capacity could not be reserved (out of memory).
+ * @note The capacity of the string is never reduced - use \a `JsonStringShrinkToFit()` to release any unused capacity.
+ */
+bool JsonStringReserve(tJsonString *String, size_t Capacity);
+
+
+/**
+ * @brief Releases any unused capacity in a string
+ * @param String The string
+ * @return A true value is returned if the unused capacity was released ok.
+ * @return A false value is returned if the content could not be reallocated (the string is left unchanged).
+ * @note The unused capacity of a string that is allocated from an arena is kept (it is only freed when the arena is cleared).
+ */
+bool JsonStringShrinkToFit(tJsonString *String);
+
+
 /**
  * @brief Adds a character to the end of a string
  * @param String    The string
  * @param Character The unicode character to add to the string
  * @return A true value is returned if the character was added to the string ok.
- * @return A false value is returned if the character could not be added to the string (out of memory or invalid character).
+ * @return A false value is returned if the character could not be added to the string (out of memory, a null character or an invalid character).
  */
 bool JsonStringAddCharacter(tJsonString *String, tJsonCharacter Character);
 
 
+/**
+ * @brief Adds a span of UTF-8 encoded bytes to the end of a string
+ * @param String The string
+ * @param Bytes  The UTF-8 encoded bytes to add to the string
+ * @param Length The number of bytes to add to the string
+ * @return A true value is returned if the bytes were added to the string ok.
+ * @return A false value is returned if the bytes could not be added to the string (out of memory).
+ * @note The bytes are not decoded - they should already be a valid UTF-8 encoding of complete characters that does not contain a null character.
+ * @note Adding zero bytes does not change the string.
+ */
+bool JsonStringAddBytes(tJsonString *String, const uint8_t *Bytes, size_t Length);
+
+
+/**
+ * @brief Adds a span of UTF-8 encoded bytes to the end of a string without copying them (if possible)
+ * @param String The string
+ * @param Bytes  The UTF-8 encoded bytes to add to the string
+ * @param Length The number of bytes to add to the string
+ * @return A true value is returned if the bytes were added to the string ok.
+ * @return A false value is returned if the bytes could not be added to the string (out of memory).
+ * @note The bytes should not contain a null character (as per \a `JsonStringAddBytes()`) and adding zero bytes does not change the string.
+ * @note If the string is empty then it becomes a view of the bytes. If the string is already a view that ends where the bytes start then the view is extended.
+ * @note The bytes are copied (as per \a `JsonStringAddBytes()`) in all other cases.
+ * @note The bytes must remain unchanged (and must not be freed) for as long as the string is a view of them.
+ * @note Any further change to the string will copy the content of the view to memory owned by the string.
+ */
+bool JsonStringAddView(tJsonString *String, const uint8_t *Bytes, size_t Length);
+
+
+/**
+ * @brief Checks if a string is a view of some external content
+ * @param String The string
+ * @return A true value is returned if the string is a view of some external content (see \a `JsonStringAddView()`).
+ * @return A false value is returned if the string owns its content (or is empty).
+ */
+bool JsonStringIsView(const tJsonString *String);
+
+
 /**
  * @brief Gets the next character from a string
  * @param String    The string
@@ -70,4 +160,28 @@ bool JsonStringAddCharacter(tJsonString *String, tJsonCharacter Character);
 size_t JsonStringGetNextCharacter(const tJsonString *String, size_t Offset, tJsonCharacter *Character);
 
 
+/**
+ * @brief The initial hash value to use with \a `JsonStringHashBytes()`
+ */
+#define JSON_STRING_HASH_INITIAL 2166136261u
+
+
+/**
+ * @brief Adds bytes to a hash value (using the FNV-1a hash function)
+ * @param Hash   The current hash value (or \a `JSON_STRING_HASH_INITIAL` for the first bytes)
+ * @param Bytes  The bytes to add to the hash value
+ * @param Length The number of bytes
+ * @return The new hash value.
+ */
+uint32_t JsonStringHashBytes(uint32_t Hash, const uint8_t *Bytes, size_t Length);
+
+
+/**
+ * @brief Gets the hash value of a string
+ * @param String The string
+ * @return The hash value of the UTF-8 encoded string content.
+ */
+uint32_t JsonStringGetHash(const tJsonString *String);
+
+
 #endif
@@ -0,0 +1,632 @@
+#include <stdlib.h>
+#include <string.h>
+#include "json_tape.h"
+#include "json.h"
+#include "json_stats.h"
+
+
+#define JSON_TAPE_MAX_COUNT UINT32_MAX
+
+
+static bool JsonTapeReserve(tJsonTape *Tape, size_t Count)
+{
+	tJsonTapeEntry *Entry;
+	size_t Capacity;
+
+	if (Count > JSON_TAPE_MAX_COUNT)
+	{
+		return false;
+	}
+
+	if (Count > Tape->Capacity)
+	{
+		Capacity = (Tape->Capacity > 0) ? Tape->Capacity : 64;
+		while (Capacity < Count)
+		{
+			Capacity = 2 * Capacity;
+		}
+
+		Entry = (tJsonTapeEntry *)JSON_STATS_REALLOC(json_StatsTape, Tape->Entry, Capacity * sizeof(tJsonTapeEntry));
+		if (Entry == NULL)
+		{
+			return false;
+		}
+
+		Tape->Entry = Entry;
+		Tape->Capacity = Capacity;
+	}
+
+	return true;
+}
+
+
+static bool JsonTapeReserveStrings(tJsonTape *Tape, size_t Length)
+{
+	uint8_t *Strings;
+	size_t Capacity;
+
+	if (Length > JSON_TAPE_MAX_COUNT)
+	{
+		return false;
+	}
+
+	if (Length > Tape->StringsCapacity)
+	{
+		Capacity = (Tape->StringsCapacity > 0) ? Tape->StringsCapacity : 256;
+		while (Capacity < Length)
+		{
+			Capacity = 2 * Capacity;
+		}
+
+		Strings = (uint8_t *)JSON_STATS_REALLOC(json_StatsTape, Tape->Strings, Capacity);
+		if (Strings == NULL)
+		{
+			return false;
+		}
+
+		Tape->Strings = Strings;
+		Tape->StringsCapacity = Capacity;
+	}
+
+	return true;
+}
+
+
+static bool JsonTapeAdd(tJsonTape *Tape, tJsonType Type, const tJsonString *Name)
+{
+	tJsonTapeEntry *Entry;
+	size_t Length;
+
+	Length = (Name != NULL) ? Name->Length : 0;
+
+	if (!JsonTapeReserve(Tape, Tape->Count + 1) || !JsonTapeReserveStrings(Tape, Tape->StringsLength + Length))
+	{
+		return false;
+	}
+
+	Entry = &Tape->Entry[Tape->Count];
+	Entry->Type = Type;
+	Entry->Next = JSON_TAPE_NONE;
+	Entry->End = (uint32_t)(Tape->Count + 1);
+	Entry->Offset = (uint32_t)Tape->StringsLength;
+	Entry->Length = (uint32_t)Length;
+
+	if (Length > 0)
+	{
+		memcpy(&Tape->Strings[Tape->StringsLength], Name->Content, Length);
+		Tape->StringsLength = Tape->StringsLength + Length;
+	}
+
+	Tape->Count++;
+
+	return true;
+}
+
+
+void JsonTapeSetUp(tJsonTape *Tape)
+{
+	Tape->Entry = NULL;
+	Tape->Count = 0;
+	Tape->Capacity = 0;
+	Tape->Strings = NULL;
+	Tape->StringsLength = 0;
+	Tape->StringsCapacity = 0;
+}
+
+
+void JsonTapeCleanUp(tJsonTape *Tape)
+{
+	JSON_STATS_FREE(json_StatsTape, Tape->Entry);
+	JSON_STATS_FREE(json_StatsTape, Tape->Strings);
+	JsonTapeSetUp(Tape);
+}
+
+
+void JsonTapeClear(tJsonTape *Tape)
+{
+	Tape->Count = 0;
+	Tape->StringsLength = 0;
+}
+
+
+bool JsonTapeFromElement(tJsonTape *Tape, const tJsonElement *Root)
+{
+	const tJsonElement *Element;
+	size_t Parent;
+	size_t Previous;
+	size_t Index;
+
+	JsonTapeClear(Tape);
+
+	if ((Root == NULL) || (Root->Type != json_TypeRoot) || !JsonTapeAdd(Tape, Root->Type, &Root->Name))
+	{
+		return false;
+	}
+
+	Parent = 0;
+	Previous = JSON_TAPE_NONE;
+	Element = Root->Child;
+	while (Element != NULL)
+	{
+		Index = Tape->Count;
+		if (!JsonTapeAdd(Tape, Element->Type, &Element->Name))
+		{
+			JsonTapeClear(Tape);
+			return false;
+		}
+
+		if (Previous != JSON_TAPE_NONE)
+		{
+			Tape->Entry[Previous].Next = (uint32_t)Index;
+		}
+
+		if (Element->Child != NULL)
+		{
+			Tape->Entry[Index].End = (uint32_t)Parent;
+			Parent = Index;
+			Previous = JSON_TAPE_NONE;
+			Element = Element->Child;
+		}
+		else
+		{
+			Previous = Index;
+			while ((Element->Parent != Root) && (Element->Next == NULL))
+			{
+				Element = Element->Parent;
+				Previous = Parent;
+				Parent = Tape->Entry[Previous].End;
+				Tape->Entry[Previous].End = (uint32_t)Tape->Count;
+			}
+			Element = Element->Next;
+		}
+	}
+
+	Tape->Entry[0].End = (uint32_t)Tape->Count;
+
+	return true;
+}
+
+
+bool JsonTapeToElement(const tJsonTape *Tape, tJsonElement *Root)
+{
+	const tJsonTapeEntry *Entry;
+	tJsonElement *Parent;
+	tJsonElement *Element;
+	size_t *End;
+	size_t *NewEnd;
+	size_t Depth;
+	size_t Size;
+	size_t n;
+	bool ok;
+
+	if ((Root == NULL) || (Root->Type != json_TypeRoot) || (Tape->Count == 0))
+	{
+		return false;
+	}
+
+	JsonElementClear(Root);
+
+	Size = 16;
+	End = (size_t *)JSON_STATS_MALLOC(json_StatsTape, Size * sizeof(size_t));
+	if (End == NULL)
+	{
+		return false;
+	}
+
+	Depth = 0;
+	End[Depth] = Tape->Entry[0].End;
+	Parent = Root;
+	Element = NULL;
+	ok = true;
+	for (n = 1; ok && (n < Tape->Count); n++)
+	{
+		Entry = &Tape->Entry[n];
+
+		while (n >= End[Depth])
+		{
+			Element = Parent;
+			Parent = Parent->Parent;
+			Depth--;
+		}
+
+		if (Element == NULL)
+		{
+			ok = JsonElementAllocateChild(Parent, Entry->Type);
+			Element = Parent->Child;
+		}
+		else
+		{
+			ok = JsonElementAllocateNext(Element, Entry->Type);
+			Element = Element->Next;
+		}
+
+		if (ok && (Entry->Length > 0))
+		{
+			ok = JsonStringAddBytes(&Element->Name, &Tape->Strings[Entry->Offset], Entry->Length);
+		}
+
+		if (ok && (Entry->End > n + 1))
+		{
+			if (Depth + 1 == Size)
+			{
+				Size = 2 * Size;
+				NewEnd = (size_t *)JSON_STATS_REALLOC(json_StatsTape, End, Size * sizeof(size_t));
+				if (NewEnd == NULL)
+				{
+					ok = false;
+					break;
+				}
+				End = NewEnd;
+			}
+
+			Depth++;
+			End[Depth] = Entry->End;
+			Parent = Element;
+			Element = NULL;
+		}
+	}
+
+	JSON_STATS_FREE(json_StatsTape, End);
+
+	if (!ok)
+	{
+		JsonElementClear(Root);
+	}
+
+	return ok;
+}
+
+
+/**
+ * @brief Type used for reading a tape from the elements that are reported by a parser (see \a `JsonParseSetUpCallback()`)
+ */
+typedef struct
+{
+	tJsonTape *Tape;     /**< The tape that is being read */
+	size_t     Parent;   /**< The index of the entry that the parsed elements are being added to */
+	size_t     Previous; /**< The index of the last entry that was added to the parent entry (or \a `JSON_TAPE_NONE` if there is none) */
+} tJsonTapeRead;
+
+
+static bool JsonTapeReadSetUp(tJsonTapeRead *Read, tJsonTape *Tape)
+{
+	JsonTapeClear(Tape);
+
+	Read->Tape = Tape;
+	Read->Parent = 0;
+	Read->Previous = JSON_TAPE_NONE;
+
+	return JsonTapeAdd(Tape, json_TypeRoot, NULL);
+}
+
+
+static void JsonTapeReadEnd(tJsonTapeRead *Read)
+{
+	Read->Previous = Read->Parent;
+	Read->Parent = Read->Tape->Entry[Read->Previous].End;
+	Read->Tape->Entry[Read->Previous].End = (uint32_t)Read->Tape->Count;
+}
+
+
+static bool JsonTapeReadElement(void *Context, const tJsonElement *Element, bool End)
+{
+	tJsonTapeRead *Read = (tJsonTapeRead *)Context;
+	tJsonTape *Tape = Read->Tape;
+	size_t Index;
+
+	if ((Tape->Entry[Read->Parent].Type == json_TypeKey) && (End || (Element->Parent->Type != json_TypeKey)))
+	{
+		JsonTapeReadEnd(Read);
+	}
+
+	if (End)
+	{
+		JsonTapeReadEnd(Read);
+		return true;
+	}
+
+	Index = Tape->Count;
+	if (!JsonTapeAdd(Tape, Element->Type, &Element->Name))
+	{
+		return false;
+	}
+
+	if (Read->Previous != JSON_TAPE_NONE)
+	{
+		Tape->Entry[Read->Previous].Next = (uint32_t)Index;
+	}
+
+	if ((Element->Type == json_TypeObject) || (Element->Type == json_TypeArray) || (Element->Type == json_TypeKey))
+	{
+		Tape->Entry[Index].End = (uint32_t)Read->Parent;
+		Read->Parent = Index;
+		Read->Previous = JSON_TAPE_NONE;
+	}
+	else
+	{
+		Read->Previous = Index;
+	}
+
+	return true;
+}
+
+
+static bool JsonTapeReadFinish(tJsonTapeRead *Read, bool ok)
+{
+	if (ok)
+	{
+		while (Read->Parent != 0)
+		{
+			JsonTapeReadEnd(Read);
+		}
+		Read->Tape->Entry[0].End = (uint32_t)Read->Tape->Count;
+	}
+	else
+	{
+		JsonTapeClear(Read->Tape);
+	}
+
+	return ok;
+}
+
+
+bool JsonTapeReadStringUtf8(tJsonTape *Tape, bool StripComments, const uint8_t *String)
+{
+	tJsonTapeRead Read;
+	tJsonElement Root;
+	tJsonParse Parse;
+	size_t Length;
+	size_t Offset = 0;
+	int State = JSON_PARSE_ERROR;
+
+	Length = (String != NULL) ? strlen((const char *)String) + 1 : 0;
+
+	JsonElementSetUp(&Root);
+
+	if (JsonTapeReadSetUp(&Read, Tape))
+	{
+		JsonParseSetUpCallback(&Parse, StripComments, &Root, JsonTapeReadElement, &Read);
+
+		do
+		{
+			State = JsonParse(&Parse, json_Utf8, String, Length, &Offset);
+		}
+		while (State == JSON_PARSE_REPORTED);
+
+		JsonParseCleanUp(&Parse);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	return JsonTapeReadFinish(&Read, State == JSON_PARSE_COMPLETE);
+}
+
+
+bool JsonTapeReadFile(tJsonTape *Tape, bool StripComments, FILE *Stream, size_t BufferSize)
+{
+	tJsonTapeRead Read;
+
+	return JsonTapeReadFinish(&Read, JsonTapeReadSetUp(&Read, Tape) && JsonReadFileCallback(JsonTapeReadElement, &Read, StripComments, Stream, BufferSize));
+}
+
+
+tJsonType JsonTapeGetType(const tJsonTape *Tape, size_t Index)
+{
+	return Tape->Entry[Index].Type;
+}
+
+
+const uint8_t *JsonTapeGetName(const tJsonTape *Tape, size_t Index, size_t *Length)
+{
+	*Length = Tape->Entry[Index].Length;
+
+	return (Tape->Strings != NULL) ? &Tape->Strings[Tape->Entry[Index].Offset] : (const uint8_t *)"";
+}
+
+
+size_t JsonTapeGetChild(const tJsonTape *Tape, size_t Index, bool IgnoreComments)
+{
+	Index = (Tape->Entry[Index].End > Index + 1) ? Index + 1 : JSON_TAPE_NONE;
+
+	if (IgnoreComments && (Index != JSON_TAPE_NONE) && (Tape->Entry[Index].Type == json_TypeComment))
+	{
+		Index = JsonTapeGetNext(Tape, Index, true);
+	}
+
+	return Index;
+}
+
+
+size_t JsonTapeGetNext(const tJsonTape *Tape, size_t Index, bool IgnoreComments)
+{
+	do
+	{
+		Index = Tape->Entry[Index].Next;
+	}
+	while (IgnoreComments && (Index != JSON_TAPE_NONE) && (Tape->Entry[Index].Type == json_TypeComment));
+
+	return Index;
+}
+
+
+static bool JsonTapeCompareName(const tJsonTape *Tape, size_t Index, const uint8_t *Name, size_t Length)
+{
+	return (Tape->Entry[Index].Length == Length) && ((Length == 0) || (memcmp(&Tape->Strings[Tape->Entry[Index].Offset], Name, Length) == 0));
+}
+
+
+static size_t JsonTapeFindPosition(const tJsonTape *Tape, size_t Index, ptrdiff_t Position)
+{
+	size_t Count = 0;
+	size_t Child;
+
+	if (Position < 0)
+	{
+		for (Child = JsonTapeGetChild(Tape, Index, true); Child != JSON_TAPE_NONE; Child = JsonTapeGetNext(Tape, Child, true))
+		{
+			Count++;
+		}
+
+		if ((size_t)-(Position + 1) >= Count)
+		{
+			return JSON_TAPE_NONE;
+		}
+		Position = (ptrdiff_t)(Count - (size_t)-(Position + 1) - 1);
+	}
+
+	for (Child = JsonTapeGetChild(Tape, Index, true); (Child != JSON_TAPE_NONE) && (Position > 0); Child = JsonTapeGetNext(Tape, Child, true))
+	{
+		Position--;
+	}
+
+	return Child;
+}
+
+
+/**
+ * @brief Type used for an array selector that is being searched by \a `JsonTapeFindPath()`
+ */
+typedef struct
+{
+	size_t Index; /**< The index of the array child that the selector path is being matched from */
+	size_t Start; /**< The index of the selector component */
+	size_t End;   /**< The index of the end of the components that the selector component is in */
+} tJsonTapeFindSelector;
+
+
+static size_t JsonTapeFindPath(const tJsonTape *Tape, size_t Index, const tJsonCompiledPath *Path)
+{
+	tJsonTapeFindSelector Selector[JSON_ELEMENT_FIND_DEPTH];
+	const tJsonCompiledPathComponent *Component;
+	const uint8_t *Name;
+	size_t Depth = 0;
+	size_t End = Path->Count;
+	size_t Next;
+	size_t n = 0;
+
+	while (n < End)
+	{
+		if ((Index != JSON_TAPE_NONE) && (Tape->Entry[Index].Type == json_TypeComment))
+		{
+			Index = JsonTapeGetNext(Tape, Index, true);
+		}
+
+		Component = &Path->Component[n];
+		Name = (Path->Names != NULL) ? &Path->Names[Component->Offset] : NULL;
+		Next = n + 1 + Component->Count;
+
+		if ((Index == JSON_TAPE_NONE) || (Component->Type != Tape->Entry[Index].Type))
+		{
+			Index = JSON_TAPE_NONE;
+		}
+		else if ((Component->Type == json_TypeArray) && Component->IsPosition)
+		{
+			Index = JsonTapeFindPosition(Tape, Index, Component->Position);
+		}
+		else if ((Component->Type == json_TypeArray) && (Depth == JSON_ELEMENT_FIND_DEPTH))
+		{
+			return JSON_TAPE_NONE;
+		}
+		else if (Component->Type == json_TypeArray)
+		{
+			Index = JsonTapeGetChild(Tape, Index, true);
+			if ((Index != JSON_TAPE_NONE) && (Component->Count != 0))
+			{
+				Selector[Depth].Index = Index;
+				Selector[Depth].Start = n;
+				Selector[Depth].End = End;
+				Depth++;
+				End = Next;
+				n = n + 1;
+				continue;
+			}
+			Index = JSON_TAPE_NONE;
+		}
+		else if (Component->Type == json_TypeKey)
+		{
+			while ((Index != JSON_TAPE_NONE) && !JsonTapeCompareName(Tape, Index, Name, Component->Length))
+			{
+				Index = JsonTapeGetNext(Tape, Index, true);
+			}
+		}
+		else if ((Component->Type != json_TypeObject) && !JsonTapeCompareName(Tape, Index, Name, Component->Length))
+		{
+			Index = JSON_TAPE_NONE;
+		}
+
+		if (Index != JSON_TAPE_NONE)
+		{
+			while ((Next == End) && (Depth > 0))
+			{
+				Depth--;
+				Index = Selector[Depth].Index;
+				n = Selector[Depth].Start;
+				End = Selector[Depth].End;
+				Next = n + 1 + Path->Component[n].Count;
+			}
+
+			if (Next == End)
+			{
+				return Index;
+			}
+
+			if (Path->Component[n].Type != json_TypeArray)
+			{
+				Index = JsonTapeGetChild(Tape, Index, false);
+			}
+			n = Next;
+			continue;
+		}
+
+		while (Index == JSON_TAPE_NONE)
+		{
+			if (Depth == 0)
+			{
+				return JSON_TAPE_NONE;
+			}
+
+			Index = JsonTapeGetNext(Tape, Selector[Depth - 1].Index, true);
+			if (Index == JSON_TAPE_NONE)
+			{
+				Depth--;
+			}
+			else
+			{
+				Selector[Depth - 1].Index = Index;
+				n = Selector[Depth - 1].Start + 1;
+				End = n + Path->Component[n - 1].Count;
+			}
+		}
+	}
+
+	return JSON_TAPE_NONE;
+}
+
+
+size_t JsonTapeFind(const tJsonTape *Tape, tJsonPath Path)
+{
+	tJsonCompiledPath CompiledPath;
+	size_t Index;
+
+	if (!JsonPathCompile(Path, &CompiledPath))
+	{
+		return JSON_TAPE_NONE;
+	}
+
+	Index = JsonTapeFindCompiled(Tape, &CompiledPath);
+
+	JsonPathCleanUpCompiled(&CompiledPath);
+
+	return Index;
+}
+
+
+size_t JsonTapeFindCompiled(const tJsonTape *Tape, const tJsonCompiledPath *Path)
+{
+	if ((Tape->Count == 0) || (Tape->Entry[0].Type != json_TypeRoot))
+	{
+		return JSON_TAPE_NONE;
+	}
+
+	return JsonTapeFindPath(Tape, JsonTapeGetChild(Tape, 0, false), Path);
+}
@@ -0,0 +1,174 @@
+#ifndef JSON_TAPE_H
+#define JSON_TAPE_H
+
+#include <stdio.h>
+#include "json_element.h"
+
+
+/**
+ * @brief The index value used to indicate that there is no tape entry (the root entry is never a child or a sibling)
+ */
+#define JSON_TAPE_NONE 0
+
+
+/**
+ * @brief Type used for an entry in a JSON tape
+ */
+typedef struct
+{
+	tJsonType Type;   /**< The element type */
+	uint32_t  Next;   /**< The index of the next (sibling) entry (or \a `JSON_TAPE_NONE` if there is no sibling) */
+	uint32_t  End;    /**< The index of the entry that follows this entry and all of its descendants */
+	uint32_t  Offset; /**< The offset to the element name in the tape strings */
+	uint32_t  Length; /**< The length of the element name (in bytes) */
+} tJsonTapeEntry;
+
+
+/**
+ * @brief Type used for a JSON tape (a read-only document held in one array of entries and one string pool)
+ * @note The entries are in document order - the first child of an entry (if any) is the entry that follows it.
+ * @note The first entry is always the root entry.
+ */
+typedef struct
+{
+	tJsonTapeEntry *Entry;           /**< The tape entries */
+	size_t          Count;           /**< The number of tape entries */
+	size_t          Capacity;        /**< The number of entries that have been allocated */
+	uint8_t        *Strings;         /**< The UTF-8 encoded names of all the elements */
+	size_t          StringsLength;   /**< The length of the names (in bytes) */
+	size_t          StringsCapacity; /**< The number of bytes that have been allocated for the names */
+} tJsonTape;
+
+
+/**
+ * @brief Sets up a JSON tape
+ * @param Tape The tape to set up
+ * @return None
+ * @note The tape will be empty (it has no entries, not even a root entry)
+ * @note Use \a `JsonTapeCleanUp()` to clean up the tape when it is no longer required
+ */
+void JsonTapeSetUp(tJsonTape *Tape);
+
+
+/**
+ * @brief Cleans up a JSON tape
+ * @param Tape The tape to clean up
+ * @return None
+ */
+void JsonTapeCleanUp(tJsonTape *Tape);
+
+
+/**
+ * @brief Clears a JSON tape (so that it has no entries)
+ * @param Tape The tape to clear
+ * @return None
+ * @note The memory of the tape is kept so that it can be reused
+ */
+void JsonTapeClear(tJsonTape *Tape);
+
+
+/**
+ * @brief Copies JSON elements to a tape
+ * @param Tape The tape to copy the elements to (any existing entries are cleared)
+ * @param Root The root element to copy
+ * @return A true value is returned if the elements were successfully copied to the tape.
+ * @return A false value is returned if the elements could not be copied to the tape (the tape is left empty).
+ * @note A tape can hold up to 4294967295 entries and 4294967295 bytes of names.
+ */
+bool JsonTapeFromElement(tJsonTape *Tape, const tJsonElement *Root);
+
+
+/**
+ * @brief Copies the entries of a JSON tape to elements
+ * @param Tape The tape to copy the entries from
+ * @param Root The root element to copy the entries to (any existing elements are cleared)
+ * @return A true value is returned if the entries were successfully copied to the elements.
+ * @return A false value is returned if the entries could not be copied to the elements.
+ */
+bool JsonTapeToElement(const tJsonTape *Tape, tJsonElement *Root);
+
+
+/**
+ * @brief Reads JSON content from a string to a tape
+ * @param Tape          The tape to read the content to (any existing entries are cleared)
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param String        The null terminated UTF-8 encoded string containing the JSON content
+ * @return A true value is returned if the JSON content was successfully read from the string.
+ * @return A false value is returned if the JSON content could not be read from the string.
+ * @note The entries are added as the elements are parsed (see \a `JsonParseSetUpCallback()`) - no tree of elements is built, so the memory used is the tape itself.
+ */
+bool JsonTapeReadStringUtf8(tJsonTape *Tape, bool StripComments, const uint8_t *String);
+
+
+/**
+ * @brief Reads JSON content from a file to a tape
+ * @param Tape          The tape to read the content to (any existing entries are cleared)
+ * @param StripComments Indicates whether comments should be stripped from the JSON content
+ * @param Stream        The file to read the JSON content from
+ * @param BufferSize    The size of the buffer that is used when reading content from the file
+ * @return A true value is returned if the JSON content was successfully read from the file.
+ * @return A false value is returned if the JSON content could not be read from the file.
+ * @note The file is read as per \a `JsonReadFileCallback()` - no tree of elements is built, so the memory used is the tape itself (and the buffer).
+ */
+bool JsonTapeReadFile(tJsonTape *Tape, bool StripComments, FILE *Stream, size_t BufferSize);
+
+
+/**
+ * @brief Gets the type of a tape entry
+ * @param Tape  The tape
+ * @param Index The index of the entry
+ * @return The entry type
+ */
+tJsonType JsonTapeGetType(const tJsonTape *Tape, size_t Index);
+
+
+/**
+ * @brief Gets the name of a tape entry
+ * @param Tape   The tape
+ * @param Index  The index of the entry
+ * @param Length Updated with the length of the name (in bytes)
+ * @return The UTF-8 encoded name (not null terminated)
+ */
+const uint8_t *JsonTapeGetName(const tJsonTape *Tape, size_t Index, size_t *Length);
+
+
+/**
+ * @brief Gets the child of a tape entry
+ * @param Tape           The tape
+ * @param Index          The index of the entry
+ * @param IgnoreComments Indicates whether to disregard any \a 'Comment' child entries
+ * @return The index of the child entry (or \a `JSON_TAPE_NONE` if there is no child)
+ */
+size_t JsonTapeGetChild(const tJsonTape *Tape, size_t Index, bool IgnoreComments);
+
+
+/**
+ * @brief Gets the next sibling of a tape entry
+ * @param Tape           The tape
+ * @param Index          The index of the entry
+ * @param IgnoreComments Indicates whether to disregard any \a 'Comment' sibling entries
+ * @return The index of the next sibling entry (or \a `JSON_TAPE_NONE` if there is no sibling)
+ */
+size_t JsonTapeGetNext(const tJsonTape *Tape, size_t Index, bool IgnoreComments);
+
+
+/**
+ * @brief Finds a tape entry
+ * @param Tape The tape
+ * @param Path The path of the entry to find (as per \a `JsonElementFind()`)
+ * @return The index of the entry that was found (or \a `JSON_TAPE_NONE` if it was not found)
+ */
+size_t JsonTapeFind(const tJsonTape *Tape, tJsonPath Path);
+
+
+/**
+ * @brief Finds a tape entry using a compiled path
+ * @param Tape The tape
+ * @param Path The compiled path of the entry to find (see \a `JsonPathCompile()`)
+ * @return The index of the entry that was found (or \a `JSON_TAPE_NONE` if it was not found)
+ * @note The path is searched without recursion - \a `JSON_TAPE_NONE` is returned if it has more than \a `JSON_ELEMENT_FIND_DEPTH` nested array selectors.
+ */
+size_t JsonTapeFindCompiled(const tJsonTape *Tape, const tJsonCompiledPath *Path);
+
+
+#endif
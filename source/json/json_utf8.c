@@ -1,5 +1,71 @@
+#include <string.h>
 #include "json_utf8.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define JSON_UTF8_X86
+#include <immintrin.h>
+#endif
+
+
+/*
+ * Error flags for the lookup table validation (each flag is set in the tables for the
+ * high nibble of the previous byte, the low nibble of the previous byte and the high
+ * nibble of the current byte - an error is where all three lookups have a flag in common)
+ */
+#define JSON_UTF8_TOO_SHORT      0x01 /* 11______ 0_______ or 11______ 11______ */
+#define JSON_UTF8_TOO_LONG       0x02 /* 0_______ 10______ */
+#define JSON_UTF8_OVERLONG_3     0x04 /* 11100000 100_____ */
+#define JSON_UTF8_TOO_LARGE      0x08 /* 11110100 1001____ or 11110100 101_____ or 11110101+ 1001____ */
+#define JSON_UTF8_SURROGATE      0x10 /* 11101101 101_____ */
+#define JSON_UTF8_OVERLONG_2     0x20 /* 1100000_ 10______ */
+#define JSON_UTF8_TOO_LARGE_1000 0x40 /* 11110101+ 1000____ */
+#define JSON_UTF8_OVERLONG_4     0x40 /* 11110000 1000____ */
+#define JSON_UTF8_TWO_CONTINUE   0x80 /* 10______ 10______ */
+#define JSON_UTF8_CARRY          (JSON_UTF8_TOO_SHORT | JSON_UTF8_TOO_LONG | JSON_UTF8_TWO_CONTINUE)
+#define JSON_UTF8_TOO_LARGE_ANY  (JSON_UTF8_CARRY | JSON_UTF8_TOO_LARGE | JSON_UTF8_TOO_LARGE_1000)
+
+
+#ifdef JSON_UTF8_X86
+static const uint8_t JsonUtf8Byte1High[16] =
+{
+	JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG,
+	JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG, JSON_UTF8_TOO_LONG,
+	JSON_UTF8_TWO_CONTINUE, JSON_UTF8_TWO_CONTINUE, JSON_UTF8_TWO_CONTINUE, JSON_UTF8_TWO_CONTINUE,
+	JSON_UTF8_TOO_SHORT | JSON_UTF8_OVERLONG_2,
+	JSON_UTF8_TOO_SHORT,
+	JSON_UTF8_TOO_SHORT | JSON_UTF8_OVERLONG_3 | JSON_UTF8_SURROGATE,
+	JSON_UTF8_TOO_SHORT | JSON_UTF8_TOO_LARGE | JSON_UTF8_TOO_LARGE_1000 | JSON_UTF8_OVERLONG_4
+};
+
+
+static const uint8_t JsonUtf8Byte1Low[16] =
+{
+	JSON_UTF8_CARRY | JSON_UTF8_OVERLONG_3 | JSON_UTF8_OVERLONG_2 | JSON_UTF8_OVERLONG_4,
+	JSON_UTF8_CARRY | JSON_UTF8_OVERLONG_2,
+	JSON_UTF8_CARRY,
+	JSON_UTF8_CARRY,
+	JSON_UTF8_CARRY | JSON_UTF8_TOO_LARGE,
+	JSON_UTF8_TOO_LARGE_ANY, JSON_UTF8_TOO_LARGE_ANY, JSON_UTF8_TOO_LARGE_ANY,
+	JSON_UTF8_TOO_LARGE_ANY, JSON_UTF8_TOO_LARGE_ANY, JSON_UTF8_TOO_LARGE_ANY, JSON_UTF8_TOO_LARGE_ANY,
+	JSON_UTF8_TOO_LARGE_ANY,
+	JSON_UTF8_TOO_LARGE_ANY | JSON_UTF8_SURROGATE,
+	JSON_UTF8_TOO_LARGE_ANY,
+	JSON_UTF8_TOO_LARGE_ANY
+};
+
+
+static const uint8_t JsonUtf8Byte2High[16] =
+{
+	JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT,
+	JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT,
+	JSON_UTF8_TOO_LONG | JSON_UTF8_OVERLONG_2 | JSON_UTF8_TWO_CONTINUE | JSON_UTF8_OVERLONG_3 | JSON_UTF8_TOO_LARGE_1000 | JSON_UTF8_OVERLONG_4,
+	JSON_UTF8_TOO_LONG | JSON_UTF8_OVERLONG_2 | JSON_UTF8_TWO_CONTINUE | JSON_UTF8_OVERLONG_3 | JSON_UTF8_TOO_LARGE,
+	JSON_UTF8_TOO_LONG | JSON_UTF8_OVERLONG_2 | JSON_UTF8_TWO_CONTINUE | JSON_UTF8_SURROGATE | JSON_UTF8_TOO_LARGE,
+	JSON_UTF8_TOO_LONG | JSON_UTF8_OVERLONG_2 | JSON_UTF8_TWO_CONTINUE | JSON_UTF8_SURROGATE | JSON_UTF8_TOO_LARGE,
+	JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT, JSON_UTF8_TOO_SHORT
+};
+#endif
+
 
 size_t JsonUtf8Encode(uint8_t *Content, size_t Length, size_t Offset, tJsonCharacter Character)
 {
@@ -118,6 +184,31 @@ size_t JsonUtf8DecodeNext(const uint8_t *Content, size_t Length, size_t Offset,
 }
 
 
+size_t JsonUtf8DecodeNextTrusted(const uint8_t *Content, size_t Offset, tJsonCharacter *Character)
+{
+	if (Content[Offset] < 0x80)
+	{
+		*Character = Content[Offset];
+		return 1;
+	}
+
+	if (Content[Offset] < 0xE0)
+	{
+		*Character = ((Content[Offset] & 0x1F) << 6) + (Content[Offset + 1] & 0x3F);
+		return 2;
+	}
+
+	if (Content[Offset] < 0xF0)
+	{
+		*Character = ((Content[Offset] & 0x0F) << 12) + ((Content[Offset + 1] & 0x3F) << 6) + (Content[Offset + 2] & 0x3F);
+		return 3;
+	}
+
+	*Character = ((Content[Offset] & 0x07) << 18) + ((Content[Offset + 1] & 0x3F) << 12) + ((Content[Offset + 2] & 0x3F) << 6) + (Content[Offset + 3] & 0x3F);
+	return 4;
+}
+
+
 size_t JsonUtf8DecodePrevious(const uint8_t *Content, size_t Length, size_t Offset, tJsonCharacter *Character)
 {
 	if ((Offset < 1) || (Offset > Length))
@@ -185,3 +276,170 @@ size_t JsonUtf8DecodePrevious(const uint8_t *Content, size_t Length, size_t Offs
 	*Character = JSON_CHARACTER_REPLACEMENT;
 	return 0;
 }
+
+
+static bool JsonUtf8ValidateScalar(const uint8_t *Content, size_t Length)
+{
+	tJsonCharacter Character;
+	size_t DecodeLength;
+	size_t n;
+
+	for (n = 0; n < Length; n = n + DecodeLength)
+	{
+		if (Content[n] < 0x80)
+		{
+			DecodeLength = 1;
+		}
+		else if ((DecodeLength = JsonUtf8DecodeNext(Content, Length, n, &Character)) == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+#ifdef JSON_UTF8_X86
+__attribute__((target("ssse3")))
+static bool JsonUtf8ValidateSsse3(const uint8_t *Content, size_t Length)
+{
+	const __m128i Byte1High = _mm_loadu_si128((const __m128i *)JsonUtf8Byte1High);
+	const __m128i Byte1Low = _mm_loadu_si128((const __m128i *)JsonUtf8Byte1Low);
+	const __m128i Byte2High = _mm_loadu_si128((const __m128i *)JsonUtf8Byte2High);
+	const __m128i Nibble = _mm_set1_epi8(0x0F);
+	const __m128i Last = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+	__m128i Error = _mm_setzero_si128();
+	__m128i Incomplete = _mm_setzero_si128();
+	__m128i Previous = _mm_setzero_si128();
+	__m128i Block;
+	__m128i Previous1;
+	__m128i Special;
+	__m128i Continue;
+	uint8_t Tail[sizeof(__m128i)];
+	size_t n;
+
+	for (n = 0; n < Length; n = n + sizeof(__m128i))
+	{
+		if (Length - n < sizeof(__m128i))
+		{
+			memset(Tail, 0, sizeof(Tail));
+			memcpy(Tail, &Content[n], Length - n);
+			Block = _mm_loadu_si128((const __m128i *)Tail);
+		}
+		else
+		{
+			Block = _mm_loadu_si128((const __m128i *)&Content[n]);
+		}
+
+		if (_mm_movemask_epi8(Block) == 0)
+		{
+			Error = _mm_or_si128(Error, Incomplete);
+			Incomplete = _mm_setzero_si128();
+		}
+		else
+		{
+			Previous1 = _mm_alignr_epi8(Block, Previous, 15);
+			Special = _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(Byte1High, _mm_and_si128(_mm_srli_epi16(Previous1, 4), Nibble)), _mm_shuffle_epi8(Byte1Low, _mm_and_si128(Previous1, Nibble))), _mm_shuffle_epi8(Byte2High, _mm_and_si128(_mm_srli_epi16(Block, 4), Nibble)));
+			Continue = _mm_and_si128(_mm_or_si128(_mm_subs_epu8(_mm_alignr_epi8(Block, Previous, 14), _mm_set1_epi8(0xE0 - 0x80)), _mm_subs_epu8(_mm_alignr_epi8(Block, Previous, 13), _mm_set1_epi8(0xF0 - 0x80))), _mm_set1_epi8((char)0x80));
+			Error = _mm_or_si128(Error, _mm_xor_si128(Continue, Special));
+			Incomplete = _mm_subs_epu8(Block, Last);
+		}
+		Previous = Block;
+	}
+
+	Error = _mm_or_si128(Error, Incomplete);
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(Error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+
+__attribute__((target("avx2")))
+static bool JsonUtf8ValidateAvx2(const uint8_t *Content, size_t Length)
+{
+	const __m256i Byte1High = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)JsonUtf8Byte1High));
+	const __m256i Byte1Low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)JsonUtf8Byte1Low));
+	const __m256i Byte2High = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)JsonUtf8Byte2High));
+	const __m256i Nibble = _mm256_set1_epi8(0x0F);
+	const __m256i Last = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+	__m256i Error = _mm256_setzero_si256();
+	__m256i Incomplete = _mm256_setzero_si256();
+	__m256i Previous = _mm256_setzero_si256();
+	__m256i Block;
+	__m256i Shifted;
+	__m256i Previous1;
+	__m256i Special;
+	__m256i Continue;
+	uint8_t Tail[sizeof(__m256i)];
+	size_t n;
+
+	for (n = 0; n < Length; n = n + sizeof(__m256i))
+	{
+		if (Length - n < sizeof(__m256i))
+		{
+			memset(Tail, 0, sizeof(Tail));
+			memcpy(Tail, &Content[n], Length - n);
+			Block = _mm256_loadu_si256((const __m256i *)Tail);
+		}
+		else
+		{
+			Block = _mm256_loadu_si256((const __m256i *)&Content[n]);
+		}
+
+		if (_mm256_movemask_epi8(Block) == 0)
+		{
+			Error = _mm256_or_si256(Error, Incomplete);
+			Incomplete = _mm256_setzero_si256();
+		}
+		else
+		{
+			Shifted = _mm256_permute2x128_si256(Previous, Block, 0x21);
+			Previous1 = _mm256_alignr_epi8(Block, Shifted, 15);
+			Special = _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(Byte1High, _mm256_and_si256(_mm256_srli_epi16(Previous1, 4), Nibble)), _mm256_shuffle_epi8(Byte1Low, _mm256_and_si256(Previous1, Nibble))), _mm256_shuffle_epi8(Byte2High, _mm256_and_si256(_mm256_srli_epi16(Block, 4), Nibble)));
+			Continue = _mm256_and_si256(_mm256_or_si256(_mm256_subs_epu8(_mm256_alignr_epi8(Block, Shifted, 14), _mm256_set1_epi8(0xE0 - 0x80)), _mm256_subs_epu8(_mm256_alignr_epi8(Block, Shifted, 13), _mm256_set1_epi8(0xF0 - 0x80))), _mm256_set1_epi8((char)0x80));
+			Error = _mm256_or_si256(Error, _mm256_xor_si256(Continue, Special));
+			Incomplete = _mm256_subs_epu8(Block, Last);
+		}
+		Previous = Block;
+	}
+
+	Error = _mm256_or_si256(Error, Incomplete);
+
+	return _mm256_testz_si256(Error, Error) != 0;
+}
+#endif
+
+
+bool JsonUtf8Validate(const uint8_t *Content, size_t Length)
+{
+#ifdef JSON_UTF8_X86
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return JsonUtf8ValidateAvx2(Content, Length);
+	}
+	else if (__builtin_cpu_supports("ssse3"))
+	{
+		return JsonUtf8ValidateSsse3(Content, Length);
+	}
+#endif
+
+	return JsonUtf8ValidateScalar(Content, Length);
+}
+
+
+size_t JsonUtf8GetCompleteLength(const uint8_t *Content, size_t Length)
+{
+	size_t DecodeLength;
+	size_t n;
+
+	for (n = Length; (n > 0) && (Length - n < JSON_UTF8_MAX_SIZE); n--)
+	{
+		if ((Content[n - 1] & 0xC0) != 0x80)
+		{
+			DecodeLength = (Content[n - 1] >= 0xF0) ? 4 : (Content[n - 1] >= 0xE0) ? 3 : (Content[n - 1] >= 0xC0) ? 2 : 1;
+			return (Length - n + 1 < DecodeLength) ? n - 1 : Length;
+		}
+	}
+
+	return Length;
+}
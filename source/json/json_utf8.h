@@ -1,6 +1,7 @@
 #ifndef JSON_UTF8_H
 #define JSON_UTF8_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "json_character.h"
 
@@ -44,6 +45,17 @@ size_t JsonUtf8Encode(uint8_t *Content, size_t Size, size_t Offset, tJsonCharact
 size_t JsonUtf8DecodeNext(const uint8_t *Content, size_t Length, size_t Offset, tJsonCharacter *Character);
 
 
+/**
+ * @brief Decodes the next character in a UTF-8 encoded content that is known to be valid
+ * @param Content   The UTF-8 encoded content
+ * @param Offset    The offset to the start of the next character to decode
+ * @param Character Used to return the next character
+ * @return The decoded length of the next character.
+ * @note The content must have been checked with \a `JsonUtf8Validate()` - the encoding is not checked.
+ */
+size_t JsonUtf8DecodeNextTrusted(const uint8_t *Content, size_t Offset, tJsonCharacter *Character);
+
+
 /**
  * @brief Decodes the previous character in a UTF-8 encoded content
  * @param Content   The UTF-8 encoded content
@@ -58,4 +70,24 @@ size_t JsonUtf8DecodeNext(const uint8_t *Content, size_t Length, size_t Offset,
 size_t JsonUtf8DecodePrevious(const uint8_t *Content, size_t Length, size_t Offset, tJsonCharacter *Character);
 
 
+/**
+ * @brief Checks if a UTF-8 encoded content is valid
+ * @param Content The UTF-8 encoded content
+ * @param Length  The length of the UTF-8 encoded content
+ * @return A true value is returned if all of the content can be decoded with \a `JsonUtf8DecodeNext()`.
+ * @note The content is checked 16 or 32 bytes at a time with vector table lookups when SSSE3 or AVX2 instructions are available (this is determined at run time).
+ */
+bool JsonUtf8Validate(const uint8_t *Content, size_t Length);
+
+
+/**
+ * @brief Gets the length of a UTF-8 encoded content without any incomplete character at its end
+ * @param Content The UTF-8 encoded content
+ * @param Length  The length of the UTF-8 encoded content
+ * @return The offset to the start of the character that is cut short by the end of the content (or \a `Length` if the last character is complete).
+ * @note Only the lead byte of the last character is checked - the content still needs to be checked with \a `JsonUtf8Validate()`.
+ */
+size_t JsonUtf8GetCompleteLength(const uint8_t *Content, size_t Length);
+
+
 #endif
@@ -1,6 +1,7 @@
 #if defined(DEBUG) && !defined(__WIN32__)
 #include <mcheck.h>
 #endif
+#include <string.h>
 #include "test_json.h"
 
 
@@ -10,15 +11,81 @@ static const tTest *Tests[] =
 	&TestJsonUtf8,
 	&TestJsonUtf16,
 	&TestJsonUtf,
+	&TestJsonArena,
+	&TestJsonRecycle,
+	&TestJsonScan,
+	&TestJsonTape,
 	&TestJsonString,
 	&TestJsonPath,
 	&TestJsonElement,
 	&TestJsonParse,
+	&TestJsonEvent,
+	&TestJsonFilter,
 	&TestJsonFormat,
+	&TestJsonStream,
+	&TestJsonRecord,
 	&TestJsonMain,
+	&TestJsonStats,
 };
 
 
+size_t TestJsonCount(const tJsonElement *Element)
+{
+	size_t Count = 0;
+
+	for (; Element != NULL; Element = Element->Next)
+	{
+		Count = Count + 1 + TestJsonCount(Element->Child);
+	}
+
+	return Count;
+}
+
+
+bool TestJsonIsEqual(const tJsonElement *Element, const tJsonElement *Other)
+{
+	if ((Element == NULL) || (Other == NULL))
+	{
+		return Element == Other;
+	}
+	else if ((Element->Type != Other->Type) || (Element->Name.Length != Other->Name.Length))
+	{
+		return false;
+	}
+	else if ((Element->Name.Length != 0) && (memcmp(Element->Name.Content, Other->Name.Content, Element->Name.Length) != 0))
+	{
+		return false;
+	}
+
+	for (Element = Element->Child, Other = Other->Child; (Element != NULL) && (Other != NULL); Element = Element->Next, Other = Other->Next)
+	{
+		if (!TestJsonIsEqual(Element, Other))
+		{
+			return false;
+		}
+	}
+
+	return (Element == NULL) && (Other == NULL);
+}
+
+
+size_t TestJsonFeed(const char *Content, size_t Length, size_t ChunkLength, tTestJsonFeed Feed, void *Context)
+{
+	size_t Offset = 0;
+	size_t ParseOffset;
+	bool IsParsing = true;
+
+	while (IsParsing && (Offset < Length))
+	{
+		ParseOffset = 0;
+		IsParsing = Feed(Context, (const uint8_t *)&Content[Offset], (Length - Offset < ChunkLength) ? Length - Offset : ChunkLength, &ParseOffset);
+		Offset = Offset + ParseOffset;
+	}
+
+	return Offset;
+}
+
+
 int main()
 {
 #if defined(DEBUG) && !defined(__WIN32__)
@@ -1,9 +1,51 @@
 #ifndef TEST_JSON_H
 #define TEST_JSON_H
 
+#include "json.h"
 #include "test.h"
 
 
+/**
+ * @brief Type used for a function that parses a chunk of JSON content (see \a `TestJsonFeed()`)
+ * @param Context The context that was passed to \a `TestJsonFeed()`
+ * @param Content The chunk of JSON content
+ * @param Length  The length of the chunk
+ * @param Offset  Used to return the length of the chunk that was parsed
+ * @return A true value is returned if the next chunk should be parsed.
+ * @return A false value is returned if the parsing should stop.
+ */
+typedef bool (* tTestJsonFeed)(void *Context, const uint8_t *Content, size_t Length, size_t *Offset);
+
+
+/**
+ * @brief Counts the elements in a list of sibling elements (including all of their children)
+ * @param Element The first element in the list
+ * @return The number of elements
+ */
+size_t TestJsonCount(const tJsonElement *Element);
+
+
+/**
+ * @brief Compares two elements (including all of their children)
+ * @param Element The element
+ * @param Other   The element to compare it to
+ * @return A true value is returned if the elements have the same types, names and children (or are both \a `NULL`).
+ */
+bool TestJsonIsEqual(const tJsonElement *Element, const tJsonElement *Other);
+
+
+/**
+ * @brief Feeds JSON content to a parsing function in chunks
+ * @param Content     The JSON content
+ * @param Length      The length of the JSON content
+ * @param ChunkLength The maximum length of each chunk
+ * @param Feed        The function that parses each chunk
+ * @param Context     The context to pass to the function
+ * @return The length of the JSON content that was parsed
+ */
+size_t TestJsonFeed(const char *Content, size_t Length, size_t ChunkLength, tTestJsonFeed Feed, void *Context);
+
+
 /**
  * @brief Contains test cases for the `JsonCharacter` set of functions
  */
@@ -28,6 +70,36 @@ extern const tTest TestJsonUtf16;
 extern const tTest TestJsonUtf;
 
 
+/**
+ * @brief Contains test cases for the `JsonArena` set of functions
+ */
+extern const tTest TestJsonArena;
+
+
+/**
+ * @brief Contains test cases for the `JsonRecycle` set of functions
+ */
+extern const tTest TestJsonRecycle;
+
+
+/**
+ * @brief Contains test cases for the `JsonScan` set of functions
+ */
+extern const tTest TestJsonScan;
+
+
+/**
+ * @brief Contains test cases for the `JsonTape` set of functions
+ */
+extern const tTest TestJsonTape;
+
+
+/**
+ * @brief Contains test cases for the `JsonStats` set of functions
+ */
+extern const tTest TestJsonStats;
+
+
 /**
  * @brief Contains test cases for the `JsonString` set of functions
  */
@@ -52,12 +124,36 @@ extern const tTest TestJsonElement;
 extern const tTest TestJsonParse;
 
 
+/**
+ * @brief Contains test cases for the `JsonEvent` set of functions
+ */
+extern const tTest TestJsonEvent;
+
+
+/**
+ * @brief Contains test cases for the `JsonFilter` set of functions
+ */
+extern const tTest TestJsonFilter;
+
+
 /**
  * @brief Contains test cases for the `JsonFormat` set of functions
  */
 extern const tTest TestJsonFormat;
 
 
+/**
+ * @brief Contains test cases for the `JsonStream` set of functions
+ */
+extern const tTest TestJsonStream;
+
+
+/**
+ * @brief Contains test cases for the `JsonRecord` set of functions
+ */
+extern const tTest TestJsonRecord;
+
+
 /**
  * @brief Contains test cases for the main set of functions used for reading and writing JSON content
  */
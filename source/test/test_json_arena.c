@@ -0,0 +1,177 @@
+#include <string.h>
+#include "json_arena.h"
+#include "test_json.h"
+
+
+static tTestResult TestJsonArenaSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonArena Arena;
+
+	JsonArenaSetUp(&Arena, 0);
+
+	TEST_IS_NULL(Arena.Chunk, TestResult);
+
+	TEST_IS_EQ(Arena.ChunkSize, JSON_ARENA_CHUNK_SIZE, TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	JsonArenaSetUp(&Arena, 1);
+
+	TEST_IS_NULL(Arena.Chunk, TestResult);
+
+	TEST_IS_EQ(Arena.ChunkSize, _Alignof(max_align_t), TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonArenaCleanUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonArena Arena;
+
+	JsonArenaSetUp(&Arena, 64);
+
+	TEST_IS_NOT_NULL(JsonArenaAllocate(&Arena, 1), TestResult);
+
+	TEST_IS_NOT_NULL(Arena.Chunk, TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	TEST_IS_NULL(Arena.Chunk, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonArenaClear(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonArena Arena;
+	size_t n;
+
+	JsonArenaSetUp(&Arena, 64);
+
+	for (n = 0; n < 100; n++)
+	{
+		TEST_IS_NOT_NULL(JsonArenaAllocate(&Arena, 32), TestResult);
+	}
+
+	TEST_IS_NOT_NULL(Arena.Chunk, TestResult);
+
+	TEST_IS_NOT_NULL(Arena.Chunk->Next, TestResult);
+
+	JsonArenaClear(&Arena);
+
+	TEST_IS_NULL(Arena.Chunk, TestResult);
+
+	TEST_IS_NOT_NULL(JsonArenaAllocate(&Arena, 32), TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonArenaAllocate(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonArena Arena;
+	uint8_t *Content[64];
+	size_t n;
+
+	JsonArenaSetUp(&Arena, 64);
+
+	TEST_IS_NULL(JsonArenaAllocate(&Arena, 0), TestResult);
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		Content[n] = (uint8_t *)JsonArenaAllocate(&Arena, n + 1);
+		TEST_IS_NOT_NULL(Content[n], TestResult);
+		TEST_IS_ZERO((uintptr_t)Content[n] % _Alignof(max_align_t), TestResult);
+		if (Content[n] != NULL)
+		{
+			memset(Content[n], (int)n, n + 1);
+		}
+	}
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		TEST_IS_EQ(Content[n][0], n, TestResult);
+		TEST_IS_EQ(Content[n][n], n, TestResult);
+	}
+
+	Content[0] = (uint8_t *)JsonArenaAllocate(&Arena, 1000);
+
+	TEST_IS_NOT_NULL(Content[0], TestResult);
+
+	TEST_IS_TRUE(Arena.Chunk->Size >= 1000, TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonArenaReallocate(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonArena Arena;
+	uint8_t *Content;
+	uint8_t *NewContent;
+
+	JsonArenaSetUp(&Arena, 256);
+
+	Content = (uint8_t *)JsonArenaReallocate(&Arena, NULL, 0, 4);
+
+	TEST_IS_NOT_NULL(Content, TestResult);
+
+	memcpy(Content, "abc", 4);
+
+	NewContent = (uint8_t *)JsonArenaReallocate(&Arena, Content, 4, 64);
+
+	TEST_IS_EQ(NewContent, Content, TestResult);
+
+	TEST_IS_NOT_NULL(JsonArenaAllocate(&Arena, 1), TestResult);
+
+	NewContent = (uint8_t *)JsonArenaReallocate(&Arena, Content, 64, 128);
+
+	TEST_IS_NOT_NULL(NewContent, TestResult);
+
+	TEST_IS_NOT_EQ(NewContent, Content, TestResult);
+
+	TEST_IS_ZERO(memcmp(NewContent, "abc", 4), TestResult);
+
+	Content = NewContent;
+
+	NewContent = (uint8_t *)JsonArenaReallocate(&Arena, Content, 128, 1024);
+
+	TEST_IS_NOT_NULL(NewContent, TestResult);
+
+	TEST_IS_ZERO(memcmp(NewContent, "abc", 4), TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonArena[] =
+{
+	{ "JsonArenaSetUp",      TestJsonArenaSetUp      },
+	{ "JsonArenaCleanUp",    TestJsonArenaCleanUp    },
+	{ "JsonArenaClear",      TestJsonArenaClear      },
+	{ "JsonArenaAllocate",   TestJsonArenaAllocate   },
+	{ "JsonArenaReallocate", TestJsonArenaReallocate }
+};
+
+
+const tTest TestJsonArena =
+{
+	"JsonArena",
+	TestCaseJsonArena,
+	sizeof(TestCaseJsonArena) / sizeof(TestCaseJsonArena[0])
+};
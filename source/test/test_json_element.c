@@ -1,5 +1,8 @@
+#include <stdio.h>
+#include <string.h>
 #include "json.h"
 #include "json_element.h"
+#include "json_tape.h"
 #include "test_json.h"
 
 
@@ -49,6 +52,90 @@ static tTestResult TestJsonElementCleanUp(void)
 }
 
 
+static tTestResult TestJsonElementSetUpArena(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Element;
+	tJsonElement Other;
+	size_t n;
+
+	TEST_IS_TRUE(JsonElementSetUpArena(&Element, 64), TestResult);
+
+	TEST_IS_EQ(JsonElementGetType(&Element), json_TypeRoot, TestResult);
+
+	TEST_IS_NULL(JsonElementGetChild(&Element, false), TestResult);
+
+	TEST_IS_NULL(JsonElementGetNext(&Element, false), TestResult);
+
+	for (n = 0; n < 3; n++)
+	{
+		TEST_IS_TRUE(JsonReadStringAscii(&Element, false, "{ \"key1\" : [ \"value1\", true, { \"key2\" : null } ] // comment\n }"), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key1[:\"value1\"]"), false), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key1[/key2:null]"), false), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key3/key4:\"a long value that needs to be allocated from more than one arena chunk\""), true), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key3/key4:\"a long value that needs to be allocated from more than one arena chunk\""), false), TestResult);
+	}
+
+	JsonElementSetUp(&Other);
+
+	TEST_IS_NULL(JsonElementMoveChild(&Other, &Element), TestResult);
+
+	TEST_IS_NULL(JsonElementMoveChild(&Element, &Other), TestResult);
+
+	JsonElementCleanUp(&Other);
+
+	JsonElementCleanUp(&Element);
+
+	TEST_IS_EQ(JsonElementGetType(&Element), json_TypeRoot, TestResult);
+
+	TEST_IS_NULL(JsonElementGetChild(&Element, false), TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementSetUpRecycle(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Element;
+	tJsonElement *Child;
+	size_t n;
+
+	TEST_IS_TRUE(JsonElementSetUpRecycle(&Element), TestResult);
+
+	TEST_IS_EQ(JsonElementGetType(&Element), json_TypeRoot, TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Element, false, "[]"), TestResult);
+
+	Child = JsonElementGetChild(&Element, false);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Element, false, "{}"), TestResult);
+
+	TEST_IS_TRUE(JsonElementGetChild(&Element, false) == Child, TestResult);
+
+	for (n = 0; n < 3; n++)
+	{
+		TEST_IS_TRUE(JsonReadStringAscii(&Element, false, "{ \"key1\" : [ \"value1\", true, { \"key2\" : null } ] }"), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key1[/key2:null]"), false), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Element, JsonPathAscii("/key3/key4:\"a long value that is added to the recycled elements\""), true), TestResult);
+	}
+
+	JsonElementCleanUp(&Element);
+
+	TEST_IS_EQ(JsonElementGetType(&Element), json_TypeRoot, TestResult);
+
+	TEST_IS_NULL(JsonElementGetChild(&Element, false), TestResult);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonElementAllocateChild(void)
 {
 	tTestResult TestResult = TEST_RESULT_INITIAL;
@@ -512,6 +599,456 @@ static tTestResult TestJsonElementFind(void)
 }
 
 
+static bool TestJsonElementFindCompiledCheck(tJsonElement *Root, const char *PathString)
+{
+	tJsonCompiledPath CompiledPath;
+	tJsonElement *Element;
+	tJsonTape Tape;
+	size_t Index;
+	bool ok;
+
+	Element = JsonElementFind(Root, JsonPathAscii(PathString), false);
+
+	JsonTapeSetUp(&Tape);
+
+	ok = JsonPathCompile(JsonPathAscii(PathString), &CompiledPath) && JsonTapeFromElement(&Tape, Root);
+	if (ok)
+	{
+		Index = JsonTapeFindCompiled(&Tape, &CompiledPath);
+		ok = (JsonElementFindCompiled(Root, &CompiledPath) == Element) && ((Element != NULL) ? (Index != JSON_TAPE_NONE) && (JsonTapeGetType(&Tape, Index) == JsonElementGetType(Element)) : (Index == JSON_TAPE_NONE));
+	}
+
+	JsonPathCleanUpCompiled(&CompiledPath);
+	JsonTapeCleanUp(&Tape);
+
+	return ok;
+}
+
+
+static tTestResult TestJsonElementFindDepth(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Paths[] = { "/a[[[:4]]][[:3]]", "/a[[[:5]]]", "/a[[[:4]]][[:1]]", "/a[[[:6]]]", "/a[[:3]][#0][#1]", "/a[[[:2]]]" };
+	char Path[2 * JSON_ELEMENT_FIND_DEPTH + 16];
+	char Content[2 * JSON_ELEMENT_FIND_DEPTH + 16];
+	tJsonElement Root;
+	tJsonElement *Element;
+	size_t Length;
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "{ \"a\" : [ [ [ 1, 2 ] ], /* comment */ [ [ 3, 4 ] ], [ [ 5 ] ] ] }"), TestResult);
+
+	for (n = 0; n < sizeof(Paths) / sizeof(Paths[0]); n++)
+	{
+		TEST_IS_TRUE(TestJsonElementFindCompiledCheck(&Root, Paths[n]), TestResult);
+	}
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/a[[[:4]]][[:3]]"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_EQ(JsonElementGetType(Element), json_TypeArray, TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a[[[:5]]]"), false), TestResult);
+
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/a[[[:4]]][[:1]]"), false), TestResult);
+
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/a[[[:6]]]"), false), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a[[[:6]]]"), true), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a[[[:6]]]"), false), TestResult);
+
+	for (n = JSON_ELEMENT_FIND_DEPTH; n <= JSON_ELEMENT_FIND_DEPTH + 1; n++)
+	{
+		Length = (size_t)sprintf(Path, "/d");
+		memset(&Path[Length], '[', n);
+		Length = Length + n + (size_t)sprintf(&Path[Length + n], ":1");
+		memset(&Path[Length], ']', n);
+		Path[Length + n] = '\0';
+
+		Element = JsonElementFind(&Root, JsonPathAscii(Path), true);
+		TEST_IS_TRUE((n <= JSON_ELEMENT_FIND_DEPTH) ? (Element != NULL) : (Element == NULL), TestResult);
+
+		Element = JsonElementFind(&Root, JsonPathAscii(Path), false);
+		TEST_IS_TRUE((n <= JSON_ELEMENT_FIND_DEPTH) ? (Element != NULL) : (Element == NULL), TestResult);
+
+		Length = (size_t)sprintf(Content, "{ \"d\" : ");
+		memset(&Content[Length], '[', n);
+		Length = Length + n + (size_t)sprintf(&Content[Length + n], "1");
+		memset(&Content[Length], ']', n);
+		sprintf(&Content[Length + n], " }");
+
+		TEST_IS_TRUE(JsonReadStringAscii(&Root, false, Content), TestResult);
+
+		Element = JsonElementFind(&Root, JsonPathAscii(Path), false);
+		TEST_IS_TRUE((n <= JSON_ELEMENT_FIND_DEPTH) ? (Element != NULL) : (Element == NULL), TestResult);
+
+		TEST_IS_TRUE(TestJsonElementFindCompiledCheck(&Root, Path), TestResult);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFindPosition(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const struct
+	{
+		const char *Path;
+		const char *Name;
+	} FindPaths[] =
+	{
+		{ "/small[#0]",                "1"     },
+		{ "/small[#2]",                "3"     },
+		{ "/small[#-1]",               "3"     },
+		{ "/small[#-3]",               "1"     },
+		{ "/small[#3]",                NULL    },
+		{ "/small[#-4]",               NULL    },
+		{ "/small[#1]:2",              "2"     },
+		{ "/small[#1]:3",              NULL    },
+		{ "/nested[#1][#0]/key",       "key"   },
+		{ "/nested[#1][#0]/key:true",  "true"  },
+		{ "/nested[#-1][#-1]",         "false" },
+		{ "/nested[#0][#0]",           NULL    },
+		{ "/key[#0]",                  NULL    }
+	};
+	tJsonCompiledPath CompiledPath;
+	tJsonElement Root;
+	tJsonElement *Element;
+	tJsonElement *Other;
+	char Path[64];
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "{ \"small\" : [ 1, /* comment */ 2, 3 ], \"nested\" : [ [], [ { \"key\" : true }, false ] ], \"key\" : \"value\" }"), TestResult);
+
+	for (n = 0; n < sizeof(FindPaths) / sizeof(FindPaths[0]); n++)
+	{
+		Element = JsonElementFind(&Root, JsonPathAscii(FindPaths[n].Path), false);
+		TEST_IS_TRUE((FindPaths[n].Name == NULL) ? (Element == NULL) : ((Element != NULL) && JsonPathCompareString(JsonPathAscii(FindPaths[n].Name), &Element->Name)), TestResult);
+
+		TEST_IS_TRUE(JsonPathCompile(JsonPathAscii(FindPaths[n].Path), &CompiledPath), TestResult);
+		TEST_IS_TRUE(JsonElementFindCompiled(&Root, &CompiledPath) == Element, TestResult);
+		JsonPathCleanUpCompiled(&CompiledPath);
+	}
+
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/small[#4]:5"), true), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/small[#3]:4"), true), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/small[#-1]:4"), false), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/created[#0]:\"value\""), true), TestResult);
+
+	for (n = 0; n < 2 * JSON_ELEMENT_INDEX_THRESHOLD; n++)
+	{
+		sprintf(Path, "/large[#%zu]:%zu", n, n);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii(Path), true), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/large[#0]:0"), false), TestResult);
+	}
+
+	for (n = 0; n < 2 * JSON_ELEMENT_INDEX_THRESHOLD; n++)
+	{
+		sprintf(Path, "/large[#%zu]:%zu", n, n);
+		Element = JsonElementFind(&Root, JsonPathAscii(Path), false);
+		TEST_IS_NOT_NULL(Element, TestResult);
+
+		sprintf(Path, "/large[#-%zu]", 2 * JSON_ELEMENT_INDEX_THRESHOLD - n);
+		TEST_IS_TRUE(JsonElementFind(&Root, JsonPathAscii(Path), false) == Element, TestResult);
+	}
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/large[#1]"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_NOT_NULL(Element->Parent->Index, TestResult);
+
+	Other = JsonElementFind(&Root, JsonPathAscii("/large[#0]"), false);
+	TEST_IS_NOT_NULL(Other, TestResult);
+	JsonElementClear(Other);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/large[#-1]"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_TRUE((Element != NULL) && (Element->Next == NULL), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFindIndexContent(tTestResult TestResult, tJsonElement *Root)
+{
+	tJsonElement *Element;
+	tJsonElement *Key;
+	tJsonElement Value;
+	char Path[64];
+	size_t n;
+
+	for (n = 0; n < 100; n++)
+	{
+		snprintf(Path, sizeof(Path), "/key%zu:%zu", n, n);
+		TEST_IS_NOT_NULL(JsonElementFind(Root, JsonPathAscii(Path), true), TestResult);
+
+		snprintf(Path, sizeof(Path), "/key%zu", n / 2);
+		Element = JsonElementFind(Root, JsonPathAscii(Path), false);
+		TEST_IS_NOT_NULL(Element, TestResult);
+		TEST_IS_EQ(JsonElementGetType(Element), json_TypeKey, TestResult);
+	}
+
+	TEST_IS_NOT_NULL(Root->Child->Index, TestResult);
+
+	TEST_IS_TRUE(Root->Child->Index->Valid, TestResult);
+
+	TEST_IS_EQ(Root->Child->Index->Count, 100, TestResult);
+
+	for (n = 0; n < 100; n++)
+	{
+		snprintf(Path, sizeof(Path), "/key%zu:%zu", n, n);
+		Element = JsonElementFind(Root, JsonPathAscii(Path), false);
+		TEST_IS_NOT_NULL(Element, TestResult);
+		TEST_IS_EQ(JsonElementGetType(Element), json_TypeValueLiteral, TestResult);
+
+		snprintf(Path, sizeof(Path), "/key%zu:%zu", n, n + 1);
+		TEST_IS_NULL(JsonElementFind(Root, JsonPathAscii(Path), false), TestResult);
+	}
+
+	TEST_IS_NULL(JsonElementFind(Root, JsonPathAscii("/key100"), false), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(Root, JsonPathAscii("/\\u006Bey7:7"), false), TestResult);
+
+	Key = JsonElementFind(Root, JsonPathAscii("/key99"), false);
+	TEST_IS_NOT_NULL(Key, TestResult);
+	TEST_IS_TRUE(JsonElementAllocateNext(Key, json_TypeKey), TestResult);
+	TEST_IS_TRUE(JsonStringAddBytes(&Key->Next->Name, (const uint8_t *)"key7", 4), TestResult);
+
+	TEST_IS_FALSE(Root->Child->Index->Valid, TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(Root, JsonPathAscii("/key7:7"), false), TestResult);
+
+	TEST_IS_TRUE(Root->Child->Index->Valid, TestResult);
+
+	JsonStringClear(&Key->Next->Name);
+	TEST_IS_TRUE(JsonStringAddBytes(&Key->Next->Name, (const uint8_t *)"key100", 6), TestResult);
+	JsonElementClearIndex(Root->Child);
+
+	TEST_IS_EQ(JsonElementFind(Root, JsonPathAscii("/key100"), false), Key->Next, TestResult);
+
+	JsonElementSetUp(&Value);
+	TEST_IS_NOT_NULL(JsonElementFind(&Value, JsonPathAscii("/key1:1"), true), TestResult);
+	if (Root->Allocator == NULL)
+	{
+		TEST_IS_NOT_NULL(JsonElementMoveChild(Root->Child, Value.Child), TestResult);
+		TEST_IS_NULL(JsonElementFind(Root, JsonPathAscii("/key7"), false), TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(Root, JsonPathAscii("/key1:1"), false), TestResult);
+	}
+	JsonElementCleanUp(&Value);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFindIndex(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+
+	JsonElementSetUp(&Root);
+
+	TestResult = TestJsonElementFindIndexContent(TestResult, &Root);
+
+	JsonElementCleanUp(&Root);
+
+	TEST_IS_TRUE(JsonElementSetUpArena(&Root, 256), TestResult);
+
+	TestResult = TestJsonElementFindIndexContent(TestResult, &Root);
+
+	JsonElementClear(&Root);
+
+	TestResult = TestJsonElementFindIndexContent(TestResult, &Root);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFindCompiled(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Paths[] =
+	{
+		"/",
+		"/key1",
+		"/key1:123",
+		"/key1:124",
+		"/\"key\\u0031\":123",
+		"/key2:\"hello world\"",
+		"/key2:hello world",
+		"/key3[/object:1]",
+		"/key3[/object:1]/key31:\"hello again\"",
+		"/key3[/object:2]/key32[/object:322]/key322:true",
+		"/key3[/object:2]/key32[/object:323]",
+		"/key3[/object:2]/key31",
+		"/key3[:\"text\"]",
+		"/key3[:text]",
+		"/key3[[:1]]",
+		"/key3[[:3]]",
+		"/key3[]",
+		"/many/k0:0",
+		"/many/k19:19",
+		"/many/k19:20",
+		"/many/k20",
+		"/many/k\\/:\"slash\"",
+		"key1",
+		"/key1/key2",
+		"/key3/object",
+		"",
+		"[",
+	};
+	const char *Content =
+		"{\"key1\": 123, // comment\n"
+		" \"key2\": \"hello world\",\n"
+		" \"key3\": [{\"object\": 1, \"key31\": \"hello again\"}, /* comment */ {\"object\": 2, \"key32\": [{\"object\": 321}, {\"object\": 322, \"key322\": true}]}, \"text\", [1, 2]],\n"
+		" \"many\": {\"k0\": 0, \"k1\": 1, \"k2\": 2, \"k3\": 3, \"k4\": 4, \"k5\": 5, \"k6\": 6, \"k7\": 7, \"k8\": 8, \"k9\": 9, /* comment */\n"
+		"  \"k10\": 10, \"k11\": 11, \"k12\": 12, \"k13\": 13, \"k14\": 14, \"k15\": 15, \"k16\": 16, \"k17\": 17, \"k18\": 18, \"k19\": 19, \"k/\": \"slash\"}}";
+	tJsonCompiledPath CompiledPath;
+	tJsonElement Root;
+	size_t Repeat;
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, Content), TestResult);
+
+	for (Repeat = 0; Repeat < 2; Repeat++)
+	{
+		for (n = 0; n < sizeof(Paths) / sizeof(Paths[0]); n++)
+		{
+			JsonPathCompile(JsonPathAscii(Paths[n]), &CompiledPath);
+
+			TEST_IS_EQ(JsonElementFindCompiled(&Root, &CompiledPath), JsonElementFind(&Root, JsonPathAscii(Paths[n]), false), TestResult);
+
+			JsonPathCleanUpCompiled(&CompiledPath);
+		}
+	}
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/many/k19:19"), false), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/many/k\\/:\"slash\""), false), TestResult);
+
+	TEST_IS_NULL(JsonElementFindCompiled(Root.Child, &CompiledPath), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFreePrevious(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonElement *Element;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, true, "[ 1, [ 2 ], { \"a\" : 3 }, 4 ]"), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("[#2]"), false);
+
+	TEST_IS_NOT_NULL(Element, TestResult);
+
+	JsonElementFreePrevious(Element);
+
+	TEST_IS_EQ(Root.Child->Child, Element, TestResult);
+	TEST_IS_EQ(JsonElementFind(&Root, JsonPathAscii("[#0]"), false), Element, TestResult);
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("[#1]"), false), TestResult);
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("[#2]"), false), TestResult);
+
+	JsonElementFreePrevious(Element);
+
+	TEST_IS_EQ(Root.Child->Child, Element, TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementFreeLast(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonElement *Element;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, true, "[ 1, [ 2 ], 3 ]"), TestResult);
+
+	Element = JsonElementGetChild(&Root, false);
+
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("[#2]"), false), TestResult);
+	TEST_IS_EQ(JsonElementFreeLast(Element), JsonElementFind(&Root, JsonPathAscii("[#1]"), false), TestResult);
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("[#2]"), false), TestResult);
+	TEST_IS_EQ(JsonElementFreeLast(Element), Element->Child, TestResult);
+	TEST_IS_NULL(JsonElementFreeLast(Element), TestResult);
+	TEST_IS_NULL(Element->Child, TestResult);
+	TEST_IS_NULL(JsonElementFreeLast(Element), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonElementExtract(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonElement Other;
+	tJsonElement *Element;
+
+	JsonElementSetUp(&Root);
+	JsonElementSetUp(&Other);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "{ \"a\" : [ 1, { \"b\" : 2 } ], \"c\" : /* note */ 3 }"), TestResult);
+	TEST_IS_TRUE(JsonReadStringAscii(&Other, false, "[ 4 ]"), TestResult);
+
+	TEST_IS_NULL(JsonElementExtract(&Root, NULL), TestResult);
+	TEST_IS_NULL(JsonElementExtract(&Root, &Root), TestResult);
+	TEST_IS_NULL(JsonElementExtract(&Root, Other.Child), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/a[#1]"), false);
+
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_EQ(JsonElementExtract(&Root, Element), Element, TestResult);
+	TEST_IS_EQ(Element->Parent, &Root, TestResult);
+	TEST_IS_NULL(Element->Next, TestResult);
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/b:2"), false), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "{ \"a\" : [ 1, { \"b\" : 2 } ], \"c\" : /* note */ 3 }"), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/c"), false);
+
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_NOT_NULL(JsonElementExtract(&Root, Element), TestResult);
+	TEST_IS_EQ(JsonElementGetType(Root.Child), json_TypeComment, TestResult);
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii(":3"), false), TestResult);
+
+	JsonElementCleanUp(&Other);
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonElementMoveChild(void)
 {
 	tTestResult TestResult = TEST_RESULT_INITIAL;
@@ -1005,11 +1542,20 @@ static const tTestCase TestCaseJsonElement[] =
 {
 	{ "JsonElementSetUp",         TestJsonElementSetUp         },
 	{ "JsonElementCleanUp",       TestJsonElementCleanUp       },
+	{ "JsonElementSetUpArena",    TestJsonElementSetUpArena    },
+	{ "JsonElementSetUpRecycle",  TestJsonElementSetUpRecycle  },
 	{ "JsonElementAllocateChild", TestJsonElementAllocateChild },
 	{ "JsonElementAllocateNext",  TestJsonElementAllocateNext  },
 	{ "JsonElementGetChild",      TestJsonElementGetChild      },
 	{ "JsonElementGetNext",       TestJsonElementGetNext       },
 	{ "JsonElementFind",          TestJsonElementFind          },
+	{ "JsonElementFindDepth",     TestJsonElementFindDepth     },
+	{ "JsonElementFindPosition",  TestJsonElementFindPosition  },
+	{ "JsonElementFindIndex",     TestJsonElementFindIndex     },
+	{ "JsonElementFindCompiled",  TestJsonElementFindCompiled  },
+	{ "JsonElementFreePrevious",  TestJsonElementFreePrevious  },
+	{ "JsonElementFreeLast",      TestJsonElementFreeLast      },
+	{ "JsonElementExtract",       TestJsonElementExtract       },
 	{ "JsonElementMoveChild",     TestJsonElementMoveChild     }
 };
 
@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <string.h>
+#include "json.h"
+#include "test_json.h"
+
+
+#define TEST_JSON_EVENT_CONTENT "{ \"key\" : [ \"a\\nb\", 12, true, { } ], /* c1\n   c2 */ \"k2\" : null // end\n }"
+#define TEST_JSON_EVENT_LOG     "{0;K1:key;[1;S2:a\nb;L2:12;L2:true;{2;}2;]1;C1: c1;C1:c2 ;K1:k2;L1:null;C1: end;}0;"
+
+
+typedef struct
+{
+	char   Log[256];
+	size_t Length;
+	size_t Count;
+	size_t Limit;
+} tTestJsonEventLog;
+
+
+static void TestJsonEventLogSetUp(tTestJsonEventLog *Log, size_t Limit)
+{
+	Log->Log[0] = '\0';
+	Log->Length = 0;
+	Log->Count = 0;
+	Log->Limit = Limit;
+}
+
+
+static bool TestJsonEventLogAdd(void *Context, const tJsonEvent *Event)
+{
+	static const char Type[] = { '{', '}', '[', ']', 'K', 'S', 'L', 'C' };
+	tTestJsonEventLog *Log = (tTestJsonEventLog *)Context;
+	int Length;
+
+	if ((Log->Limit != 0) && (Log->Count == Log->Limit))
+	{
+		return false;
+	}
+
+	if (Event->Length != 0)
+	{
+		Length = snprintf(&Log->Log[Log->Length], sizeof(Log->Log) - Log->Length, "%c%zu:%.*s;", Type[Event->Type], Event->Depth, (int)Event->Length, (const char *)Event->Content);
+	}
+	else
+	{
+		Length = snprintf(&Log->Log[Log->Length], sizeof(Log->Log) - Log->Length, "%c%zu;", Type[Event->Type], Event->Depth);
+	}
+
+	if ((Length > 0) && ((size_t)Length < sizeof(Log->Log) - Log->Length))
+	{
+		Log->Length = Log->Length + (size_t)Length;
+	}
+	Log->Count++;
+
+	return true;
+}
+
+
+static bool TestJsonEventRead(bool StripComments, const char *Content, tTestJsonEventLog *Log)
+{
+	tJsonEventParse Parse;
+	int State;
+
+	JsonEventSetUp(&Parse, StripComments);
+
+	State = JsonEventParse(&Parse, json_Utf8, (const uint8_t *)Content, strlen(Content) + 1, NULL, TestJsonEventLogAdd, Log);
+
+	JsonEventCleanUp(&Parse);
+
+	return State == JSON_EVENT_COMPLETE;
+}
+
+
+static tTestResult TestJsonEventSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonEventParse Parse;
+
+	JsonEventSetUp(&Parse, true);
+
+	TEST_IS_EQ(Parse.Parse.State, json_ParseValueStart, TestResult);
+	TEST_IS_EQ(Parse.Parse.Element, &Parse.Root, TestResult);
+	TEST_IS_NOT_NULL(Parse.Parse.Callback, TestResult);
+	TEST_IS_TRUE(Parse.Parse.StripComments, TestResult);
+	TEST_IS_ZERO(Parse.Depth, TestResult);
+	TEST_IS_ZERO(Parse.QueueCount, TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	TEST_IS_EQ(Parse.Parse.State, json_ParseComplete, TestResult);
+	TEST_IS_NULL(Parse.Parse.Element, TestResult);
+	TEST_IS_NULL(Parse.Root.Child, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonEventNextUtf8(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	const uint8_t *Content = (const uint8_t *)TEST_JSON_EVENT_CONTENT;
+	tTestJsonEventLog Log;
+	tJsonEventParse Parse;
+	tJsonEvent Event;
+	size_t Size = strlen(TEST_JSON_EVENT_CONTENT) + 1;
+	size_t Offset = 0;
+	int State;
+
+	TestJsonEventLogSetUp(&Log, 0);
+	JsonEventSetUp(&Parse, false);
+
+	while ((State = JsonEventNextUtf8(&Parse, Content, Size, &Offset, &Event)) == JSON_EVENT_AVAILABLE)
+	{
+		if ((Event.Type == json_EventKey) || (Event.Type == json_EventLiteral))
+		{
+			TEST_IS_TRUE((Event.Content >= Content) && (Event.Content + Event.Length <= Content + Size), TestResult);
+		}
+		else if (Event.Type == json_EventString)
+		{
+			TEST_IS_FALSE((Event.Content >= Content) && (Event.Content < Content + Size), TestResult);
+		}
+		TestJsonEventLogAdd(&Log, &Event);
+	}
+
+	TEST_IS_EQ(State, JSON_EVENT_COMPLETE, TestResult);
+	TEST_IS_EQ(Offset, Size, TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, TEST_JSON_EVENT_LOG), TestResult);
+	TEST_IS_EQ(JsonEventNextUtf8(&Parse, Content, Size, &Offset, &Event), JSON_EVENT_COMPLETE, TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	TestJsonEventLogSetUp(&Log, 0);
+	JsonEventSetUp(&Parse, false);
+
+	for (Offset = 0; Offset < Size; Offset++)
+	{
+		State = JsonEventParse(&Parse, json_Utf8, &Content[Offset], 1, NULL, TestJsonEventLogAdd, &Log);
+		TEST_IS_EQ(State, (Offset + 1 < Size) ? JSON_EVENT_INCOMPLETE : JSON_EVENT_COMPLETE, TestResult);
+	}
+
+	TEST_IS_ZERO(strcmp(Log.Log, TEST_JSON_EVENT_LOG), TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonEventNext(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	const char *Content = TEST_JSON_EVENT_CONTENT;
+	tTestJsonEventLog Log;
+	tJsonEventParse Parse;
+	tJsonEvent Event;
+	uint8_t Buffer[256];
+	size_t Length = 0;
+	size_t Offset = 0;
+	size_t Index;
+	int State;
+
+	for (Index = 0; Content[Index] != '\0'; Index++)
+	{
+		Length = Length + JsonUtfEncode(json_Utf16le, Buffer, sizeof(Buffer), Length, (uint8_t)Content[Index]);
+	}
+	Length = Length + JsonUtfEncode(json_Utf16le, Buffer, sizeof(Buffer), Length, '\0');
+
+	TestJsonEventLogSetUp(&Log, 0);
+	JsonEventSetUp(&Parse, false);
+
+	while ((State = JsonEventNext(&Parse, json_Utf16le, Buffer, Length, &Offset, &Event)) == JSON_EVENT_AVAILABLE)
+	{
+		TestJsonEventLogAdd(&Log, &Event);
+	}
+
+	TEST_IS_EQ(State, JSON_EVENT_COMPLETE, TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, TEST_JSON_EVENT_LOG), TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	TestJsonEventLogSetUp(&Log, 0);
+	JsonEventSetUp(&Parse, false);
+
+	TEST_IS_EQ(JsonEventParse(&Parse, json_Utf16be, (const uint8_t *)"\0[\0\"\xD8\x3D\xDE\x00\0\\\0u\0\x30\0\x30\0\x34\0\x31\0\"\0]\0\0", 26, NULL, TestJsonEventLogAdd, &Log), JSON_EVENT_COMPLETE, TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "[0;S1:\xF0\x9F\x98\x80" "A;]0;"), TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonEventParse(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tTestJsonEventLog Log;
+
+	TestJsonEventLogSetUp(&Log, 0);
+	TEST_IS_TRUE(TestJsonEventRead(true, TEST_JSON_EVENT_CONTENT, &Log), TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "{0;K1:key;[1;S2:a\nb;L2:12;L2:true;{2;}2;]1;K1:k2;L1:null;}0;"), TestResult);
+
+	TestJsonEventLogSetUp(&Log, 3);
+	TEST_IS_FALSE(TestJsonEventRead(false, TEST_JSON_EVENT_CONTENT, &Log), TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "{0;K1:key;[1;"), TestResult);
+
+	TestJsonEventLogSetUp(&Log, 0);
+	TEST_IS_TRUE(TestJsonEventRead(false, " \"\\u0041\\\"\" ", &Log), TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "S0:A\";"), TestResult);
+
+	TestJsonEventLogSetUp(&Log, 0);
+	TEST_IS_TRUE(TestJsonEventRead(false, "[\"\",-1.5e+3]", &Log), TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "[0;S1;L1:-1.5e+3;]0;"), TestResult);
+
+	TestJsonEventLogSetUp(&Log, 0);
+	TEST_IS_TRUE(TestJsonEventRead(false, "/**/ 1 /* a **/", &Log), TestResult);
+	TEST_IS_ZERO(strcmp(Log.Log, "C0;L0:1;C0: a *;"), TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonEventValid(void)
+{
+	static const char *Content[] =
+	{
+		"", " ", "1", "\"a\"", "[]", "{}", "[[]]", "{\"a\":{}}", "[1,[2,{\"b\":[]}],3]", "{\"a\":1,\"b\":[true,null]}",
+		"[1,]", "{\"a\":1,}", "{\"a\"}", "{\"a\":}", "{,}", "[,1]", "]", "}", "[}", "{]", "[1}", "{\"a\":1]", "1 2", "1,", "[1", "{\"a\":1",
+		"\"abc", "\"\\x\"", "\"\\uD800\"", "/", "/* a", "[ // a\n 1 ]", "{ \"a\" /* b */ : /* c */ 1 }", "tru e", "[1 2]", "{1:2}",
+		"/*c*/", "//c\n", "[/**/]", "[//l\n]", "{/**/}", "{//l\n}", "[1/**/]", "[1,/**/]", "[/**/1]", "{\"a\":1/**/}", "{/**/\"a\":1}",
+		"/**/1", "1/**/", "/* a\n b */ 1", "[/* a\n */]", "{\"a\":/**/}", "1 /**/ 2", "\"a\" // b",
+	};
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tTestJsonEventLog Log;
+	tJsonElement Root;
+	size_t Index;
+	size_t Strip;
+
+	JsonElementSetUp(&Root);
+
+	for (Strip = 0; Strip < 2; Strip++)
+	{
+		for (Index = 0; Index < sizeof(Content) / sizeof(Content[0]); Index++)
+		{
+			TestJsonEventLogSetUp(&Log, 0);
+			TEST_IS_EQ(TestJsonEventRead(Strip != 0, Content[Index], &Log), JsonReadStringAscii(&Root, Strip != 0, Content[Index]), TestResult);
+		}
+	}
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonEventDepth(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonEventParse Parse;
+	tJsonEvent Event;
+	uint8_t Content[2001];
+	size_t Depth = 0;
+	size_t MaxDepth = 0;
+	size_t Offset = 0;
+	int State;
+
+	memset(Content, '[', 1000);
+	memset(&Content[1000], ']', 1000);
+	Content[2000] = '\0';
+
+	JsonEventSetUp(&Parse, false);
+
+	while ((State = JsonEventNextUtf8(&Parse, Content, sizeof(Content), &Offset, &Event)) == JSON_EVENT_AVAILABLE)
+	{
+		if (Event.Type == json_EventArrayStart)
+		{
+			TEST_IS_EQ(Event.Depth, Depth, TestResult);
+			Depth++;
+			MaxDepth = (Depth > MaxDepth) ? Depth : MaxDepth;
+		}
+		else
+		{
+			Depth--;
+			TEST_IS_EQ(Event.Depth, Depth, TestResult);
+		}
+	}
+
+	TEST_IS_EQ(State, JSON_EVENT_COMPLETE, TestResult);
+	TEST_IS_EQ(MaxDepth, 1000, TestResult);
+	TEST_IS_ZERO(Depth, TestResult);
+
+	JsonEventCleanUp(&Parse);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonEvent[] =
+{
+	{ "JsonEventSetUp",    TestJsonEventSetUp    },
+	{ "JsonEventNextUtf8", TestJsonEventNextUtf8 },
+	{ "JsonEventNext",     TestJsonEventNext     },
+	{ "JsonEventParse",    TestJsonEventParse    },
+	{ "JsonEventValid",    TestJsonEventValid    },
+	{ "JsonEventDepth",    TestJsonEventDepth    }
+};
+
+
+const tTest TestJsonEvent =
+{
+	"JsonEvent",
+	TestCaseJsonEvent,
+	sizeof(TestCaseJsonEvent) / sizeof(TestCaseJsonEvent[0])
+};
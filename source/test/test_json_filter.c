@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "json.h"
+#include "test_json.h"
+
+
+#define TEST_JSON_FILTER_CONTENT                                                             \
+	"{\n"                                                                                    \
+	"  // leading comment\n"                                                                 \
+	"  \"name\" : \"filter\",\n"                                                             \
+	"  \"skip\" : { \"a\" : [ 1, { \"b\" : \"}]\\\"\" } ], \"c\" : null }, /* after */\n"    \
+	"  \"list\" : [ 10, /* c */ { \"id\" : 1, \"v\" : \"x\" }, [ 20, 21 ], { \"id\" : 2, \"v\" : \"y\" }, true ],\n" \
+	"  \"nest\" : { \"deep\" : { \"deeper\" : { \"value\" : -1.5e3 } }, \"other\" : false },\n" \
+	"  \"esc\\/key\" : \"escaped\",\n"                                                       \
+	"  \"last\" : [ [ 1, 2 ], [ 3, 4 ] ] // trailing\n"                                     \
+	"}"
+
+
+typedef struct
+{
+	tJsonParse Parse;
+	int        State;
+} tTestJsonFilterRead;
+
+
+static bool TestJsonFilterFeed(void *Context, const uint8_t *Content, size_t Length, size_t *Offset)
+{
+	tTestJsonFilterRead *Read = (tTestJsonFilterRead *)Context;
+
+	Read->State = JsonParse(&Read->Parse, json_Utf8, Content, Length, Offset);
+
+	return Read->State == JSON_PARSE_INCOMPLETE;
+}
+
+
+static int TestJsonFilterRead(tJsonElement *Root, bool StripComments, const char *Content, size_t ChunkLength, const tJsonPath *Path, size_t PathCount)
+{
+	tTestJsonFilterRead Read;
+	tJsonFilter Filter;
+
+	Read.State = JSON_PARSE_ERROR;
+
+	JsonFilterSetUp(&Filter, Path, PathCount);
+
+	if (JsonParseSetUpFilter(&Read.Parse, StripComments, Root, &Filter))
+	{
+		Read.State = JSON_PARSE_INCOMPLETE;
+		TestJsonFeed(Content, strlen(Content) + 1, ChunkLength, TestJsonFilterFeed, &Read);
+	}
+
+	JsonParseCleanUp(&Read.Parse);
+	JsonFilterCleanUp(&Filter);
+
+	return Read.State;
+}
+
+
+static bool TestJsonFilterCheck(bool StripComments, const char *Content, const char *PathString, size_t ChunkLength, size_t MaxCount)
+{
+	tJsonElement Full;
+	tJsonElement Root;
+	tJsonPath Path;
+	bool ok;
+
+	Path = JsonPathAscii(PathString);
+
+	JsonElementSetUp(&Full);
+	JsonElementSetUp(&Root);
+
+	ok = JsonReadStringAscii(&Full, StripComments, Content) &&
+	     (TestJsonFilterRead(&Root, StripComments, Content, ChunkLength, &Path, 1) == JSON_PARSE_COMPLETE) &&
+	     TestJsonIsEqual(JsonElementFind(&Full, Path, false), JsonElementFind(&Root, Path, false)) &&
+	     (TestJsonCount(Root.Child) <= MaxCount);
+
+	JsonElementCleanUp(&Root);
+	JsonElementCleanUp(&Full);
+
+	return ok;
+}
+
+
+static tTestResult TestJsonFilterSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonFilter Filter;
+	tJsonElement Root;
+	tJsonPath Path;
+
+	Path = JsonPathAscii("/a");
+
+	JsonElementSetUp(&Root);
+
+	JsonFilterSetUp(&Filter, &Path, 1);
+
+	TEST_IS_EQ(Filter.Path, &Path, TestResult);
+	TEST_IS_EQ(Filter.PathCount, 1, TestResult);
+	TEST_IS_ZERO(Filter.FrameCount, TestResult);
+	TEST_IS_ZERO(Filter.TailCount, TestResult);
+
+	TEST_IS_TRUE(JsonFilterStart(&Filter, &Root), TestResult);
+	TEST_IS_EQ(Filter.FrameCount, 1, TestResult);
+	TEST_IS_EQ(Filter.TailCount, 1, TestResult);
+	TEST_IS_EQ(JsonFilterValue(&Filter, &Root, json_TypeObject), json_FilterKeep, TestResult);
+	TEST_IS_EQ(JsonFilterValue(&Filter, &Root, json_TypeArray), json_FilterSkip, TestResult);
+
+	JsonFilterCleanUp(&Filter);
+
+	TEST_IS_NULL(Filter.Path, TestResult);
+	TEST_IS_NULL(Filter.Frame, TestResult);
+	TEST_IS_NULL(Filter.Tail, TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFilterPath(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const struct
+	{
+		const char *Path;
+		size_t      MaxCount;
+	} Paths[] =
+	{
+		{ "/name",                         4  },
+		{ "/name:\"filter\"",              4  },
+		{ "/name:\"other\"",               4  },
+		{ "/nest/deep/deeper/value",       10 },
+		{ "/nest/deep",                    10 },
+		{ "/nest/other:false",             6  },
+		{ "/list[#0]",                     5  },
+		{ "/list[#1]/v",                   10 },
+		{ "/list[#2][#1]",                 10 },
+		{ "/list[#3]",                     14 },
+		{ "/list[#9]",                     12 },
+		{ "/list[#-1]",                    20 },
+		{ "/list[/id:2]/v",                24 },
+		{ "/list[/id:3]",                  24 },
+		{ "/list[:true]",                  24 },
+		{ "/last[[:3]]",                   14 },
+		{ "/esc\\/key",                    4  },
+		{ "/skip/a[#1]/b",                 10 },
+		{ "/missing",                      2  },
+		{ "[#0]",                          2  },
+		{ "/",                             64 }
+	};
+	size_t ChunkLength[] = { 1, 3, 7, 4096 };
+	size_t n;
+	size_t m;
+
+	for (n = 0; n < sizeof(Paths) / sizeof(Paths[0]); n++)
+	{
+		for (m = 0; m < sizeof(ChunkLength) / sizeof(ChunkLength[0]); m++)
+		{
+			TEST_IS_TRUE(TestJsonFilterCheck(true, TEST_JSON_FILTER_CONTENT, Paths[n].Path, ChunkLength[m], Paths[n].MaxCount), TestResult);
+			TEST_IS_TRUE(TestJsonFilterCheck(false, TEST_JSON_FILTER_CONTENT, Paths[n].Path, ChunkLength[m], Paths[n].MaxCount + 8), TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFilterPaths(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *PathStrings[] = { "/name", "/list[#2]", "/nest/deep/deeper" };
+	tJsonElement Full;
+	tJsonElement Root;
+	tJsonPath Path[3];
+	size_t n;
+
+	for (n = 0; n < 3; n++)
+	{
+		Path[n] = JsonPathAscii(PathStrings[n]);
+	}
+
+	JsonElementSetUp(&Full);
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Full, true, TEST_JSON_FILTER_CONTENT), TestResult);
+	TEST_IS_EQ(TestJsonFilterRead(&Root, true, TEST_JSON_FILTER_CONTENT, 5, Path, 3), JSON_PARSE_COMPLETE, TestResult);
+
+	for (n = 0; n < 3; n++)
+	{
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, Path[n], false), TestResult);
+		TEST_IS_TRUE(TestJsonIsEqual(JsonElementFind(&Full, Path[n], false), JsonElementFind(&Root, Path[n], false)), TestResult);
+	}
+
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/skip"), false), TestResult);
+	TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/nest/other"), false), TestResult);
+
+	JsonElementCleanUp(&Root);
+	JsonElementCleanUp(&Full);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFilterValues(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content[] =
+	{
+		"5",
+		"\"a\\\"b\"",
+		"[]",
+		"{}",
+		"[ 1, [ 2, [ 3 ] ], { \"a\" : [] } ]",
+		"{ \"a\" : 1 } /* end */",
+		"{ \"a\" : /* before */ { \"b\" : 2 } /* after */, \"c\" : 3 }",
+		"[ /* first */ 1, /* second */ 2 /* end */ ]"
+	};
+	static const char *PathStrings[] = { "/a", "/c", ":5", "[#1]", "[#1][#1]", "[#2]/a", "[#-1]", "/a/b" };
+	size_t n;
+	size_t m;
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		for (m = 0; m < sizeof(PathStrings) / sizeof(PathStrings[0]); m++)
+		{
+			TEST_IS_TRUE(TestJsonFilterCheck(false, Content[n], PathStrings[m], 1, 64), TestResult);
+			TEST_IS_TRUE(TestJsonFilterCheck(true, Content[n], PathStrings[m], 2, 64), TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFilterDuplicate(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content[] =
+	{
+		"{ \"a\" : 1, \"a\" : { \"b\" : 2 } }",
+		"{ \"a\" : { \"c\" : 1 }, \"a\" : { \"b\" : 2 } }",
+		"{ \"a\" : [ 1 ], \"a\" : { \"b\" : 2 }, \"b\" : 3, \"b\" : [ 4 ] }",
+		"[ { \"a\" : { \"b\" : 1 }, \"a\" : { \"b\" : 2 } }, { \"a\" : 3, \"a\" : { \"b\" : 4 } } ]"
+	};
+	static const char *PathStrings[] = { "/a", "/a/b", "/a/c", "/a:1", "/a[#0]", "/b", "/b[#0]", "[#0]/a/b", "[#1]/a/b", "[/a:3]" };
+	tJsonElement Root;
+	tJsonPath Path;
+	size_t n;
+	size_t m;
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		for (m = 0; m < sizeof(PathStrings) / sizeof(PathStrings[0]); m++)
+		{
+			TEST_IS_TRUE(TestJsonFilterCheck(false, Content[n], PathStrings[m], 1, 24), TestResult);
+			TEST_IS_TRUE(TestJsonFilterCheck(true, Content[n], PathStrings[m], 4096, 24), TestResult);
+		}
+	}
+
+	Path = JsonPathAscii("/a/b");
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_EQ(TestJsonFilterRead(&Root, true, Content[0], 3, &Path, 1), JSON_PARSE_COMPLETE, TestResult);
+	TEST_IS_NULL(JsonElementFind(&Root, Path, false), TestResult);
+	TEST_IS_EQ(TestJsonCount(Root.Child), 3, TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFilterError(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content[] =
+	{
+		"{ \"a\" : { \"b\" : 1 }",
+		"{ \"a\" : \"unterminated }",
+		"{ \"skip\" : 1 \"a\" : 2 }",
+		"{ \"skip\" : [ 1 ] ]",
+		"{ \"a\" : [ 1 } }",
+		"{ \"skip\" : 1 } x",
+		"{ \"skip\" : [ }, \"a\" : 1 }",
+		"{ \"skip\" : { ], \"a\" : 1 }",
+		"{ \"skip\" : [ { \"b\" : [ 1 } ] ], \"a\" : 1 }",
+		"{ \"skip\" : { \"b\" : [ \"]\" ] ] }, \"a\" : 1 }"
+	};
+	size_t ChunkLength[] = { 3, 4096 };
+	tJsonElement Root;
+	tJsonPath Path;
+	char *Deep;
+	size_t Length;
+	size_t Depth;
+	size_t n;
+	size_t m;
+
+	Path = JsonPathAscii("/a");
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		for (m = 0; m < sizeof(ChunkLength) / sizeof(ChunkLength[0]); m++)
+		{
+			JsonElementSetUp(&Root);
+
+			TEST_IS_EQ(TestJsonFilterRead(&Root, true, Content[n], ChunkLength[m], &Path, 1), JSON_PARSE_ERROR, TestResult);
+
+			JsonElementCleanUp(&Root);
+		}
+	}
+
+	Deep = (char *)malloc(2 * JSON_PARSE_SKIP_DEPTH + 32);
+
+	TEST_IS_NOT_NULL(Deep, TestResult);
+
+	for (Depth = JSON_PARSE_SKIP_DEPTH; (Deep != NULL) && (Depth <= JSON_PARSE_SKIP_DEPTH + 1); Depth++)
+	{
+		Length = (size_t)sprintf(Deep, "{ \"skip\" : ");
+		memset(&Deep[Length], '[', Depth);
+		memset(&Deep[Length + Depth], ']', Depth);
+		strcpy(&Deep[Length + 2 * Depth], ", \"a\" : 1 }");
+
+		for (m = 0; m < sizeof(ChunkLength) / sizeof(ChunkLength[0]); m++)
+		{
+			JsonElementSetUp(&Root);
+
+			TEST_IS_EQ(TestJsonFilterRead(&Root, true, Deep, ChunkLength[m], &Path, 1), (Depth > JSON_PARSE_SKIP_DEPTH) ? JSON_PARSE_ERROR : JSON_PARSE_COMPLETE, TestResult);
+
+			JsonElementCleanUp(&Root);
+		}
+	}
+
+	free(Deep);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonFilter[] =
+{
+	{ "JsonFilterSetUp",     TestJsonFilterSetUp     },
+	{ "JsonFilterPath",      TestJsonFilterPath      },
+	{ "JsonFilterPaths",     TestJsonFilterPaths     },
+	{ "JsonFilterValues",    TestJsonFilterValues    },
+	{ "JsonFilterDuplicate", TestJsonFilterDuplicate },
+	{ "JsonFilterError",     TestJsonFilterError     }
+};
+
+
+const tTest TestJsonFilter =
+{
+	"JsonFilter",
+	TestCaseJsonFilter,
+	sizeof(TestCaseJsonFilter) / sizeof(TestCaseJsonFilter[0])
+};
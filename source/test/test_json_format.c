@@ -1085,6 +1085,79 @@ static tTestResult TestJsonFormatValueUtf16(void)
 }
 
 
+static tTestResult TestJsonFormatUtf8Content(tTestResult TestResult, tJsonElement *Root, size_t IndentSize, tJsonCommentType CommentType)
+{
+	tJsonFormat Format;
+	tJsonCharacter Character;
+	uint8_t Expected[1024];
+	uint8_t Content[1024];
+	size_t ExpectedLength;
+	size_t Length;
+	size_t Offset;
+	size_t Size;
+	int State;
+
+	JsonFormatSetUpIndent(&Format, IndentSize, CommentType, Root);
+
+	for (ExpectedLength = 0; (State = JsonFormatCharacter(&Format, &Character)) == JSON_FORMAT_INCOMPLETE; ExpectedLength = ExpectedLength + Length)
+	{
+		Length = JsonUtf8Encode(Expected, sizeof(Expected), ExpectedLength, Character);
+		TEST_IS_NOT_ZERO(Length, TestResult);
+	}
+
+	TEST_IS_EQ(State, JSON_FORMAT_COMPLETE, TestResult);
+
+	JsonFormatCleanUp(&Format);
+
+	for (Size = JSON_FORMAT_MIN_SIZE; Size < 40; Size++)
+	{
+		JsonFormatSetUpIndent(&Format, IndentSize, CommentType, Root);
+
+		for (Length = 0, State = JSON_FORMAT_INCOMPLETE; (State == JSON_FORMAT_INCOMPLETE) && (Length + Size <= sizeof(Content)); Length = Length + Offset)
+		{
+			Offset = 0;
+			State = JsonFormatUtf8(&Format, &Content[Length], Size, &Offset);
+		}
+
+		TEST_IS_EQ(State, JSON_FORMAT_COMPLETE, TestResult);
+		TEST_IS_EQ(Length, ExpectedLength, TestResult);
+		TEST_IS_ZERO(memcmp(Content, Expected, ExpectedLength), TestResult);
+
+		JsonFormatCleanUp(&Format);
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonFormatUtf8(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonParse Parse;
+	const char *Content =
+		"// comment \xC2\xA9 with a long line of text\n"
+		"{\"key \xE2\x82\xAC\\\"\\n\\u0001 0123456789abcdefghijklmnopqrstuvwxyz\": [\"value \xF0\x9F\x98\x80 0123456789abcdefghijklmnopqrstuvwxyz \\t end\", 1234567890123456789, true,\n"
+		"/* block\n * comment */ {\"nested\": {\"deep\": [null, -1.5e+10, \"\\\\\"]}, \"\": \"\"}]}";
+
+	JsonElementSetUp(&Root);
+
+	JsonParseSetUp(&Parse, false, &Root);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, (const uint8_t *)Content, strlen(Content) + 1, 0), JSON_PARSE_COMPLETE, TestResult);
+
+	JsonParseCleanUp(&Parse);
+
+	TestResult = TestJsonFormatUtf8Content(TestResult, &Root, 0, json_CommentNone);
+	TestResult = TestJsonFormatUtf8Content(TestResult, &Root, 7, json_CommentLine);
+	TestResult = TestJsonFormatUtf8Content(TestResult, &Root, 2, json_CommentBlock);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
 static const tTestCase TestCaseJsonFormat[] =
 {
 	{ "JsonFormatCompress",     TestJsonFormatCompress     },
@@ -1094,6 +1167,7 @@ static const tTestCase TestCaseJsonFormat[] =
 	{ "JsonFormatCommentBlock", TestJsonFormatCommentBlock },
 	{ "JsonFormatKeyUtf16",     TestJsonFormatKeyUtf16     },
 	{ "JsonFormatValueUtf16",   TestJsonFormatValueUtf16   },
+	{ "JsonFormatUtf8",         TestJsonFormatUtf8         },
 };
 
 
@@ -1,4 +1,12 @@
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define TEST_JSON_PIPE
+#endif
+
 #include <string.h>
+#ifdef TEST_JSON_PIPE
+#include <unistd.h>
+#endif
 #include "json.h"
 #include "test_json.h"
 
@@ -27,6 +35,35 @@ static tTestResult TestJsonReadStringAscii(void)
 }
 
 
+static tTestResult TestJsonReadStringUtf8View(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Content[] = "{ \"key\": [ \"value\" ] }";
+	tJsonElement Root;
+	tJsonElement *Element;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_FALSE(JsonReadStringUtf8View(&Root, false, NULL), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringUtf8View(&Root, false, Content), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/key[:\"value\"]"), false);
+
+	TEST_IS_NOT_NULL(Element, TestResult);
+
+	TEST_IS_TRUE((Element != NULL) && (Element->Name.Content == &Content[12]), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringUtf8View(&Root, false, (const uint8_t *)""), TestResult);
+
+	TEST_IS_NULL(JsonElementGetChild(&Root, false), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonWriteFileContent(tTestResult TestResult, tJsonElement *Root, tJsonUtfType UtfType, bool RequireBom)
 {
 	tJsonFormat Format;
@@ -190,11 +227,542 @@ static tTestResult TestJsonReadFile(void)
 }
 
 
+static tTestResult TestJsonReadFileOffset(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	FILE *File;
+#ifdef TEST_JSON_PIPE
+	int Pipe[2];
+#endif
+
+	JsonElementSetUp(&Root);
+
+	File = fopen("test.json", "w+");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("#!{ \"key\": \"value\" }", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 2, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonReadFile(&Root, true, File, 1), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key:\"value\""), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_FALSE(JsonReadFile(&Root, true, File, 1), TestResult);
+
+		fclose(File);
+	}
+
+#ifdef TEST_JSON_PIPE
+	TEST_IS_ZERO(pipe(Pipe), TestResult);
+
+	TEST_IS_TRUE(write(Pipe[1], "[ \"value\" ]", 11) == 11, TestResult);
+
+	close(Pipe[1]);
+
+	File = fdopen(Pipe[0], "r");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(JsonReadFile(&Root, true, File, 4), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("[:\"value\"]"), false), TestResult);
+
+		fclose(File);
+	}
+#endif
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static bool TestJsonReadFileEventsCount(void *Context, const tJsonEvent *Event)
+{
+	size_t *Count = (size_t *)Context;
+
+	*Count = *Count + Event->Length + 1;
+
+	return true;
+}
+
+
+static tTestResult TestJsonReadFileEvents(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	size_t Count = 0;
+	FILE *File;
+
+	File = fopen("test.json", "w+");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("{ \"key\": [ \"value\", 123 ] } // comment\n", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonReadFileEvents(TestJsonReadFileEventsCount, &Count, true, File, 1), TestResult);
+
+		TEST_IS_EQ(Count, 18, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		Count = 0;
+
+		TEST_IS_TRUE(JsonReadFileEvents(TestJsonReadFileEventsCount, &Count, false, File, 1), TestResult);
+
+		TEST_IS_EQ(Count, 27, TestResult);
+
+		fclose(File);
+	}
+
+	return TestResult;
+}
+
+
+static bool TestJsonReadFileRecordsCount(void *Context, size_t Index, tJsonElement *Root)
+{
+	size_t *Count = (size_t *)Context;
+
+	if (Root != NULL)
+	{
+		*Count = *Count + Index + 1;
+	}
+
+	return true;
+}
+
+
+static tTestResult TestJsonReadFileRecords(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	size_t Count = 0;
+	FILE *File;
+
+	File = fopen("test.json", "w+");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("\xEF\xBB\xBF{ \"a\": 1 }\n[ 2 ]\n\"three\" // comment\n4\n", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonReadFileRecords(TestJsonReadFileRecordsCount, &Count, true, false, 2, File, 1), TestResult);
+
+		TEST_IS_EQ(Count, 10, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		Count = 0;
+
+		TEST_IS_TRUE(JsonReadFileRecords(TestJsonReadFileRecordsCount, &Count, false, true, 0, File, 4096), TestResult);
+
+		TEST_IS_EQ(Count, 10, TestResult);
+
+		fclose(File);
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonReadFileFilter(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonPath Path[2];
+	FILE *File;
+
+	Path[0] = JsonPathAscii("/key[#1]");
+	Path[1] = JsonPathAscii("/other/a");
+
+	JsonElementSetUp(&Root);
+
+	File = fopen("test.json", "w+");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("{ \"key\": [ \"value\", 123, [ 4 ] ], \"skip\": { \"a\": 1 }, \"other\": { \"a\": true, \"b\": null } } // comment\n", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonReadFileFilter(&Root, false, Path, 2, File, 1), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key[#1]:123"), false), TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/other/a:true"), false), TestResult);
+		TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/key[#2]"), false), TestResult);
+		TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/skip"), false), TestResult);
+		TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/other/b"), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonReadFileFilter(&Root, true, Path, 0, File, 4096), TestResult);
+
+		TEST_IS_NULL(Root.Child, TestResult);
+
+		fclose(File);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonReadFind(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	FILE *File;
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	File = fopen("test.json", "w+");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("{ \"first\": { \"a\": [ 1, 2 ] /* c */ }, \"list\": [ { \"id\": 1 }, { \"id\": 2, \"v\": \"x\" } ], \"large\": [ ", File) >= 0, TestResult);
+		for (n = 0; n < 10000; n++)
+		{
+			TEST_IS_TRUE(fputs("\"padding\", ", File) >= 0, TestResult);
+		}
+		TEST_IS_TRUE(fputs("0 ], \"last\": true }\n", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(JsonReadFind(&Root, false, JsonPathAscii("/first"), File, 256), TestResult);
+		TEST_IS_TRUE(ftell(File) <= 512, TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a[#1]:2"), false), TestResult);
+		TEST_IS_NULL(JsonElementFind(&Root, JsonPathAscii("/first"), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(JsonReadFind(&Root, true, JsonPathAscii("/list[/id:2]/v"), File, 256), TestResult);
+		TEST_IS_TRUE(ftell(File) <= 512, TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii(":\"x\""), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(JsonReadFind(&Root, true, JsonPathAscii("/large[#-1]"), File, 256), TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii(":0"), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(JsonReadFind(&Root, true, JsonPathAscii("/last"), File, 256), TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii(":true"), false), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(JsonReadFind(&Root, true, JsonPathAscii("/missing"), File, 256), TestResult);
+		TEST_IS_NULL(Root.Child, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_TRUE(fputs("{ \"a\": [ 1 } ", File) >= 0, TestResult);
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+		TEST_IS_FALSE(JsonReadFind(&Root, true, JsonPathAscii("/a"), File, 256), TestResult);
+		TEST_IS_NULL(Root.Child, TestResult);
+
+		fclose(File);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonReadFindDuplicate(void)
+{
+	static const struct
+	{
+		const char *Content;
+		const char *Path;
+		const char *Value;
+	} Test[] =
+	{
+		{ "{ \"a\": 1, \"a\": { \"b\": 2 } }",                 "/a/b",     NULL                },
+		{ "{ \"a\": 1, \"a\": { \"b\": 2 } }",                 "/a",       "1"                 },
+		{ "{ \"a\": { \"c\": 1 }, \"a\": { \"b\": 2 } }",        "/a/b",     NULL                },
+		{ "{ \"a\": { \"c\": 1 }, \"a\": { \"b\": 2 } }",        "/a",       "{ \"c\": 1 }"      },
+		{ "{ \"a\": [ 1 ], \"a\": [ 2, 3 ] }",                "/a[#-1]",  "1"                 },
+		{ "[ { \"a\": 3, \"a\": 4 }, { \"a\": 4 } ]",           "[/a:4]",   "{ \"a\": 4 }"      },
+		{ "{ \"a\": { \"b\": 1, \"b\": 2 }, \"a\": { \"b\": 3 } }", "/a/b",     "1"                 }
+	};
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Full;
+	tJsonElement Root;
+	tJsonElement Value;
+	tJsonElement *Element;
+	FILE *File;
+	size_t n;
+
+	JsonElementSetUp(&Full);
+	JsonElementSetUp(&Root);
+	JsonElementSetUp(&Value);
+
+	for (n = 0; n < sizeof(Test) / sizeof(Test[0]); n++)
+	{
+		File = tmpfile();
+
+		TEST_IS_NOT_NULL(File, TestResult);
+
+		if (File != NULL)
+		{
+			TEST_IS_TRUE(fputs(Test[n].Content, File) >= 0, TestResult);
+			TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+			TEST_IS_TRUE(JsonReadFind(&Root, true, JsonPathAscii(Test[n].Path), File, 4), TestResult);
+
+			TEST_IS_TRUE(JsonReadStringAscii(&Full, true, Test[n].Content), TestResult);
+			Element = JsonElementFind(&Full, JsonPathAscii(Test[n].Path), false);
+
+			if (Test[n].Value == NULL)
+			{
+				TEST_IS_NULL(Element, TestResult);
+				TEST_IS_NULL(Root.Child, TestResult);
+			}
+			else
+			{
+				TEST_IS_NOT_NULL(Element, TestResult);
+				TEST_IS_TRUE(JsonReadStringAscii(&Value, true, Test[n].Value), TestResult);
+				TEST_IS_TRUE(TestJsonIsEqual(Root.Child, Value.Child), TestResult);
+			}
+
+			fclose(File);
+		}
+	}
+
+	JsonElementCleanUp(&Value);
+	JsonElementCleanUp(&Root);
+	JsonElementCleanUp(&Full);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonReadPath(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	FILE *File;
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_FALSE(JsonReadPath(&Root, true, NULL, 1), TestResult);
+
+	TEST_IS_FALSE(JsonReadPath(&Root, true, "test-missing.json", 1), TestResult);
+
+	File = fopen("test.json", "w");
+
+	TEST_IS_NOT_NULL(File, TestResult);
+
+	if (File != NULL)
+	{
+		TEST_IS_TRUE(fputs("{ \"key\": [ 1, 2, 3 ] }", File) >= 0, TestResult);
+
+		fclose(File);
+	}
+
+	TEST_IS_TRUE(JsonReadPath(&Root, true, "test.json", 1), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key[:3]"), false), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamFile(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Value;
+	tJsonEdit Edit;
+	char Output[64];
+	size_t EditError;
+	size_t Length;
+	FILE *File;
+	FILE *OutputFile;
+
+	JsonElementSetUp(&Value);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Value, true, "4"), TestResult);
+
+	JsonEditSetUp(&Edit, JsonPathAscii("/key[#1]"), &Value);
+
+	File = fopen("test.json", "w+");
+	OutputFile = tmpfile();
+
+	TEST_IS_NOT_NULL(File, TestResult);
+	TEST_IS_NOT_NULL(OutputFile, TestResult);
+
+	if ((File != NULL) && (OutputFile != NULL))
+	{
+		TEST_IS_TRUE(fputs("{ \"key\": [ 1, [ 2 ], 3 ] } // comment\n", File) >= 0, TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		TEST_IS_TRUE(JsonStreamFile(&Edit, 1, File, json_Utf8, false, 0, json_CommentNone, OutputFile, 1, &EditError), TestResult);
+
+		TEST_IS_EQ(EditError, 1, TestResult);
+
+		TEST_IS_EQ(Edit.State, json_EditApplied, TestResult);
+
+		TEST_IS_ZERO(fseek(OutputFile, 0, SEEK_SET), TestResult);
+
+		Length = fread(Output, 1, sizeof(Output) - 1, OutputFile);
+		Output[Length] = '\0';
+
+		TEST_IS_ZERO(strcmp(Output, "{ \"key\": [ 1, [ 4 ], 3 ] }"), TestResult);
+
+		TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+		JsonEditSetUp(&Edit, JsonPathAscii("/key[#1]/a"), &Value);
+
+		TEST_IS_FALSE(JsonStreamFile(&Edit, 1, File, json_Utf8, false, 0, json_CommentNone, OutputFile, 1, NULL), TestResult);
+
+		TEST_IS_EQ(Edit.State, json_EditNoPath, TestResult);
+	}
+
+	if (File != NULL)
+	{
+		fclose(File);
+	}
+
+	if (OutputFile != NULL)
+	{
+		fclose(OutputFile);
+	}
+
+	JsonElementCleanUp(&Value);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamFileEditError(void)
+{
+	static const struct
+	{
+		const char    *Content;
+		const char    *Edit[3][2];
+		bool           Result;
+		size_t         EditError;
+		tJsonEditState State;
+	} Test[] =
+	{
+		{ "",                                        { { NULL } },                                                     false, 0, json_EditPending },
+		{ "   ",                                     { { NULL } },                                                     false, 0, json_EditPending },
+		{ "{",                                       { { NULL } },                                                     false, 1, json_EditPending },
+		{ "{",                                       { { "[/x:1]/a", "bad" } },                                        false, 2, json_EditPending },
+		{ "{",                                       { { "/a", "{" } },                                                false, 2, json_EditPending },
+		{ "{ \"a\": 1,",                             { { "/a", "{" } },                                                false, 2, json_EditPending },
+		{ "[ 1 ]",                                   { { "/a", "1" }, { "/b", "{" } },                                 false, 0, json_EditNoPath  },
+		{ "[ 1 ]",                                   { { "/a", "{" }, { "/b", "1" } },                                 false, 0, json_EditNoPath  },
+		{ "{ \"a\": [ { \"n\": 1 } ], \"c\": 3 }",     { { "/a[/n:1]", "2" }, { "/c", "{" } },                           false, 0, json_EditNoValue },
+		{ "{ \"a\": [ { \"n\": 1 } ], \"c\": 3 }",     { { "/c", "{" }, { "/a[/n:1]", "2" } },                           false, 0, json_EditNoValue },
+		{ "{ \"a\": [ { \"n\": 1 } ], \"c\": 3 }",     { { "/c", "4" }, { "/a[/n:1]", "2" }, { "/c", "{" } },            false, 1, json_EditNoValue },
+		{ "{ \"a\": [ 1 ], \"b\": { \"c\": 1 } }",     { { "/a/x", "1" }, { "/b/c", "{" } },                             false, 0, json_EditNoPath  },
+		{ "{ \"a\": 1, \"b\": 2 }",                    { { "/b", "{" }, { "/a", "3" }, { "/a/x", "4" } },                false, 0, json_EditNoValue },
+		{ "{ \"a\": 1, \"b\": 2 }",                    { { "/b", "3" }, { "/a", "{ \"x\": 4 }" }, { "/a/x", "{" } },     false, 2, json_EditNoValue },
+		{ "{ \"a\": 1, \"b\": 2 }",                    { { "/b", "3" }, { "/a", "{ \"x\": 4 }" }, { "/a/x", "5" } },     true,  3, json_EditPending }
+	};
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Value[3];
+	tJsonEdit Edit[3];
+	size_t EditCount;
+	size_t EditError;
+	size_t n;
+	size_t m;
+	FILE *File;
+	FILE *OutputFile;
+
+	for (n = 0; n < 3; n++)
+	{
+		JsonElementSetUp(&Value[n]);
+	}
+
+	for (n = 0; n < sizeof(Test) / sizeof(Test[0]); n++)
+	{
+		for (EditCount = 0; (EditCount < 3) && (Test[n].Edit[EditCount][0] != NULL); EditCount++)
+		{
+			JsonEditSetUp(&Edit[EditCount], JsonPathAscii(Test[n].Edit[EditCount][0]), JsonReadStringAscii(&Value[EditCount], false, Test[n].Edit[EditCount][1]) ? &Value[EditCount] : NULL);
+		}
+
+		File = tmpfile();
+		OutputFile = tmpfile();
+
+		TEST_IS_NOT_NULL(File, TestResult);
+		TEST_IS_NOT_NULL(OutputFile, TestResult);
+
+		if ((File != NULL) && (OutputFile != NULL))
+		{
+			TEST_IS_TRUE(fputs(Test[n].Content, File) >= 0, TestResult);
+
+			TEST_IS_ZERO(fseek(File, 0, SEEK_SET), TestResult);
+
+			TEST_IS_EQ(JsonStreamFile(Edit, EditCount, File, json_Utf8, false, 3, json_CommentLine, OutputFile, 4, &EditError), Test[n].Result, TestResult);
+
+			TEST_IS_EQ(EditError, Test[n].EditError, TestResult);
+
+			if (EditError < EditCount)
+			{
+				TEST_IS_EQ(Edit[EditError].State, Test[n].State, TestResult);
+
+				for (m = 0; m < EditError; m++)
+				{
+					TEST_IS_EQ(Edit[m].State, json_EditApplied, TestResult);
+				}
+			}
+		}
+
+		if (File != NULL)
+		{
+			fclose(File);
+		}
+
+		if (OutputFile != NULL)
+		{
+			fclose(OutputFile);
+		}
+	}
+
+	for (n = 0; n < 3; n++)
+	{
+		JsonElementCleanUp(&Value[n]);
+	}
+
+	return TestResult;
+}
+
+
 static const tTestCase TestCaseJsonMain[] =
 {
-	{ "JsonReadStringAscii", TestJsonReadStringAscii },
-	{ "JsonWriteFile",       TestJsonWriteFile       },
-	{ "JsonReadFile",        TestJsonReadFile        }
+	{ "JsonReadStringAscii",    TestJsonReadStringAscii    },
+	{ "JsonReadStringUtf8View", TestJsonReadStringUtf8View },
+	{ "JsonWriteFile",          TestJsonWriteFile          },
+	{ "JsonReadFile",           TestJsonReadFile           },
+	{ "JsonReadFileOffset",     TestJsonReadFileOffset     },
+	{ "JsonReadFileEvents",     TestJsonReadFileEvents     },
+	{ "JsonReadFileRecords",    TestJsonReadFileRecords    },
+	{ "JsonReadFileFilter",     TestJsonReadFileFilter     },
+	{ "JsonReadFind",           TestJsonReadFind           },
+	{ "JsonReadFindDuplicate",  TestJsonReadFindDuplicate  },
+	{ "JsonReadPath",           TestJsonReadPath           },
+	{ "JsonStreamFile",         TestJsonStreamFile         },
+	{ "JsonStreamFileEditError", TestJsonStreamFileEditError }
 };
 
 
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <string.h>
 #include "json_character.h"
 #include "json_parse.h"
@@ -691,6 +692,426 @@ static tTestResult TestJsonParseCommentBlockInvalid(void)
 }
 
 
+static bool TestJsonParseCompareElement(tJsonElement *Left, tJsonElement *Right)
+{
+	if ((Left == NULL) || (Right == NULL))
+	{
+		return Left == Right;
+	}
+
+	return (Left->Type == Right->Type) &&
+	       (Left->Name.Length == Right->Name.Length) &&
+	       ((Left->Name.Length == 0) || (memcmp(Left->Name.Content, Right->Name.Content, Left->Name.Length) == 0)) &&
+	       TestJsonParseCompareElement(Left->Child, Right->Child) &&
+	       TestJsonParseCompareElement(Left->Next, Right->Next);
+}
+
+
+static tTestResult TestJsonParseUtf8Span(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content[] =
+	{
+		"{ \"key\": \"value\", \"long-key-name\": \"a long string value with \xC2\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 characters\" }",
+		"[ \"escape \\t\\n\\\"\\u00e9 in the middle\", 12345.678e-9, true, null ]",
+		"// line comment with \xE2\x82\xAC\r\n{ \"key\": /* block comment\n   * second line */ \"value\" }",
+		"/** block ** comment */ [ { \"a\": \"b\" }, \"\" ] // trailing comment\n",
+	};
+	tJsonElement SpanRoot;
+	tJsonElement CharacterRoot;
+	tJsonParse SpanParse;
+	tJsonParse CharacterParse;
+	tJsonCharacter Character;
+	size_t Length;
+	size_t Offset;
+	size_t n;
+	int StripComments;
+
+	for (StripComments = 0; StripComments < 2; StripComments++)
+	{
+		for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+		{
+			JsonElementSetUp(&SpanRoot);
+			JsonElementSetUp(&CharacterRoot);
+			JsonParseSetUp(&SpanParse, StripComments, &SpanRoot);
+			JsonParseSetUp(&CharacterParse, StripComments, &CharacterRoot);
+
+			Length = strlen(Content[n]) + 1;
+
+			TEST_IS_EQ(JsonParse(&SpanParse, json_Utf8, (const uint8_t *)Content[n], Length, NULL), JSON_PARSE_COMPLETE, TestResult);
+
+			for (Offset = 0; Offset < Length; Offset = Offset + JsonUtf8DecodeNext((const uint8_t *)Content[n], Length, Offset, &Character))
+			{
+				JsonUtf8DecodeNext((const uint8_t *)Content[n], Length, Offset, &Character);
+				JsonParseCharacter(&CharacterParse, Character);
+			}
+
+			TEST_IS_EQ(CharacterParse.State, json_ParseComplete, TestResult);
+
+			TEST_IS_TRUE(TestJsonParseCompareElement(&SpanRoot, &CharacterRoot), TestResult);
+
+			JsonParseCleanUp(&CharacterParse);
+			JsonParseCleanUp(&SpanParse);
+			JsonElementCleanUp(&CharacterRoot);
+			JsonElementCleanUp(&SpanRoot);
+		}
+	}
+
+	JsonElementSetUp(&SpanRoot);
+	JsonParseSetUp(&SpanParse, false, &SpanRoot);
+
+	Offset = 0;
+
+	TEST_IS_EQ(JsonParse(&SpanParse, json_Utf8, (const uint8_t *)"\"abc\xC0\x80" "def\"", 11, &Offset), JSON_PARSE_INCOMPLETE, TestResult);
+
+	TEST_IS_EQ(Offset, 4, TestResult);
+
+	JsonParseCleanUp(&SpanParse);
+	JsonElementCleanUp(&SpanRoot);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonParseUtf8(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Content[] =
+		"\t// comment \xE2\x82\xAC\n"
+		"{\r\n"
+		"   \"key\\u00e9\" :   [ true ,\tfalse, -1.5e3 , \"\xC2\xA9 value\" ] ,\n"
+		"   /* block\n"
+		"      comment */\n"
+		"   \"object\": { \"\xF0\x9F\x98\x80\": null }\n"
+		"}\n";
+	tJsonElement Utf8Root;
+	tJsonElement Utf16Root;
+	tJsonParse Utf8Parse;
+	tJsonParse Utf16Parse;
+	tJsonCharacter Character;
+	uint8_t Utf16[2 * sizeof(Content) * JSON_UTF_MAX_SIZE];
+	size_t Utf16Length;
+	size_t Offset;
+	size_t Split;
+
+	JsonElementSetUp(&Utf16Root);
+	JsonParseSetUp(&Utf16Parse, false, &Utf16Root);
+
+	for (Offset = 0, Utf16Length = 0; Offset < sizeof(Content); Offset = Offset + JsonUtf8DecodeNext(Content, sizeof(Content), Offset, &Character))
+	{
+		JsonUtf8DecodeNext(Content, sizeof(Content), Offset, &Character);
+		Utf16Length = Utf16Length + JsonUtfEncode(json_Utf16le, Utf16, sizeof(Utf16), Utf16Length, Character);
+	}
+
+	TEST_IS_EQ(JsonParse(&Utf16Parse, json_Utf16le, Utf16, Utf16Length, NULL), JSON_PARSE_COMPLETE, TestResult);
+
+	for (Split = 0; Split < sizeof(Content); Split++)
+	{
+		JsonElementSetUp(&Utf8Root);
+		JsonParseSetUp(&Utf8Parse, false, &Utf8Root);
+
+		Offset = 0;
+
+		TEST_IS_EQ(JsonParseUtf8(&Utf8Parse, Content, Split, &Offset), JSON_PARSE_INCOMPLETE, TestResult);
+
+		TEST_IS_EQ(JsonParseUtf8(&Utf8Parse, Content, sizeof(Content), &Offset), JSON_PARSE_COMPLETE, TestResult);
+
+		TEST_IS_EQ(Offset, sizeof(Content), TestResult);
+
+		TEST_IS_TRUE(TestJsonParseCompareElement(&Utf8Root, &Utf16Root), TestResult);
+
+		JsonParseCleanUp(&Utf8Parse);
+		JsonElementCleanUp(&Utf8Root);
+	}
+
+	JsonParseCleanUp(&Utf16Parse);
+	JsonElementCleanUp(&Utf16Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonParseUtf8Partial(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Item[] = "\"\xC2\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\", ";
+	tJsonElement Root;
+	tJsonElement ChunkRoot;
+	tJsonParse Parse;
+	uint8_t *Content;
+	size_t Length;
+	size_t Offset;
+	size_t Chunk;
+	size_t n;
+	int State;
+
+	Length = 1 + (2 * JSON_PARSE_VALIDATE_SIZE / (sizeof(Item) - 1) + 1) * (sizeof(Item) - 1) + 3;
+	Content = (uint8_t *)malloc(Length);
+
+	TEST_IS_NOT_NULL(Content, TestResult);
+
+	if (Content != NULL)
+	{
+		Content[0] = '[';
+		for (Offset = 1; Offset + sizeof(Item) - 1 < Length; Offset = Offset + sizeof(Item) - 1)
+		{
+			memcpy(&Content[Offset], Item, sizeof(Item) - 1);
+		}
+		memcpy(&Content[Offset], "1]", 3);
+
+		JsonElementSetUp(&Root);
+		JsonParseSetUp(&Parse, false, &Root);
+
+		TEST_IS_EQ(JsonParse(&Parse, json_Utf8, Content, Length, NULL), JSON_PARSE_COMPLETE, TestResult);
+
+		JsonParseCleanUp(&Parse);
+
+		for (Chunk = 1; Chunk < 6; Chunk++)
+		{
+			JsonElementSetUp(&ChunkRoot);
+			JsonParseSetUp(&Parse, false, &ChunkRoot);
+
+			for (State = JSON_PARSE_INCOMPLETE, n = 0; (State == JSON_PARSE_INCOMPLETE) && (n < Length); n = n + Chunk)
+			{
+				State = JsonParse(&Parse, json_Utf8, &Content[n], (Length - n < Chunk) ? Length - n : Chunk, NULL);
+			}
+
+			TEST_IS_EQ(State, JSON_PARSE_COMPLETE, TestResult);
+
+			TEST_IS_TRUE(TestJsonParseCompareElement(&Root, &ChunkRoot), TestResult);
+
+			JsonParseCleanUp(&Parse);
+			JsonElementCleanUp(&ChunkRoot);
+		}
+
+		JsonElementCleanUp(&Root);
+
+		free(Content);
+	}
+
+	JsonElementSetUp(&Root);
+	JsonParseSetUp(&Parse, false, &Root);
+
+	Offset = 0;
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, (const uint8_t *)"\"ab\xE2\x82", 5, &Offset), JSON_PARSE_INCOMPLETE, TestResult);
+
+	TEST_IS_EQ(Offset, 5, TestResult);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, (const uint8_t *)"c\"", 3, NULL), JSON_PARSE_ERROR, TestResult);
+
+	JsonParseCleanUp(&Parse);
+	JsonElementCleanUp(&Root);
+
+	JsonElementSetUp(&Root);
+	JsonParseSetUp(&Parse, false, &Root);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, (const uint8_t *)"[\"\xF0\x80\x80", 5, NULL), JSON_PARSE_INCOMPLETE, TestResult);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, (const uint8_t *)"\xF0\x9F\x98\x80\"]", 6, NULL), JSON_PARSE_ERROR, TestResult);
+
+	JsonParseCleanUp(&Parse);
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonParseSetUpView(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Content[] = "{ \"key\": \"value\", \"escaped\\tkey\": [ true, \"a \\\"quoted\\\" value\" ] /* comment */ }";
+	tJsonElement Root;
+	tJsonElement *Element;
+	tJsonParse Parse;
+
+	JsonElementSetUp(&Root);
+	JsonParseSetUpView(&Parse, false, &Root);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, Content, sizeof(Content), NULL), JSON_PARSE_COMPLETE, TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/key"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_TRUE((Element != NULL) && JsonStringIsView(&Element->Name), TestResult);
+	TEST_IS_TRUE((Element != NULL) && (Element->Name.Content == &Content[3]), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/key:\"value\""), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_TRUE((Element != NULL) && JsonStringIsView(&Element->Name), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/escaped\\tkey"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_TRUE((Element != NULL) && !JsonStringIsView(&Element->Name), TestResult);
+
+	Element = JsonElementFind(&Root, JsonPathAscii("/escaped\\tkey[:\"a \\\"quoted\\\" value\"]"), false);
+	TEST_IS_NOT_NULL(Element, TestResult);
+	TEST_IS_TRUE((Element != NULL) && !JsonStringIsView(&Element->Name), TestResult);
+
+	JsonParseCleanUp(&Parse);
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+typedef struct
+{
+	const uint8_t *Content;
+	size_t         Count;
+	size_t         Ends;
+	size_t         Siblings;
+	size_t         Views;
+} tTestJsonParseCallback;
+
+
+static bool TestJsonParseCallbackCount(void *Context, const tJsonElement *Element, bool End)
+{
+	tTestJsonParseCallback *Callback = (tTestJsonParseCallback *)Context;
+	const tJsonElement *Sibling;
+	size_t Siblings = 0;
+
+	for (Sibling = Element->Parent->Child; Sibling != NULL; Sibling = Sibling->Next)
+	{
+		Siblings++;
+	}
+
+	Callback->Count++;
+	Callback->Ends = Callback->Ends + (End ? 1 : 0);
+	Callback->Siblings = (Siblings > Callback->Siblings) ? Siblings : Callback->Siblings;
+	if ((Element->Name.Length != 0) && (Element->Name.Content >= Callback->Content) && (Element->Name.Content < Callback->Content + strlen((const char *)Callback->Content)))
+	{
+		Callback->Views++;
+	}
+
+	return Callback->Count != 100;
+}
+
+
+static tTestResult TestJsonParseSetUpCallback(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Content[] = "[ 1, \"two\", [ 3, 4 ], { \"a\" : 5, \"b\\n\" : null } /* six */, 7 ]";
+	tTestJsonParseCallback Callback = { Content, 0, 0, 0, 0 };
+	tJsonElement Root;
+	tJsonParse Parse;
+	size_t Offset = 0;
+	size_t Calls = 0;
+	int State;
+
+	JsonElementSetUp(&Root);
+	JsonParseSetUpCallback(&Parse, false, &Root, TestJsonParseCallbackCount, &Callback);
+
+	TEST_IS_TRUE(Parse.ViewContent, TestResult);
+	TEST_IS_EQ(Parse.Context, &Callback, TestResult);
+
+	while ((State = JsonParse(&Parse, json_Utf8, Content, sizeof(Content), &Offset)) == JSON_PARSE_REPORTED)
+	{
+		Calls++;
+	}
+
+	TEST_IS_EQ(State, JSON_PARSE_COMPLETE, TestResult);
+	TEST_IS_EQ(Offset, sizeof(Content), TestResult);
+	TEST_IS_EQ(Callback.Count, 16, TestResult);
+	TEST_IS_EQ(Callback.Ends, 3, TestResult);
+	TEST_IS_EQ(Calls, 16, TestResult);
+	TEST_IS_EQ(Callback.Siblings, 1, TestResult);
+	TEST_IS_EQ(Callback.Views, 9, TestResult);
+
+	JsonParseCleanUp(&Parse);
+
+	Callback.Count = 99;
+	JsonParseSetUpCallback(&Parse, true, &Root, TestJsonParseCallbackCount, &Callback);
+
+	TEST_IS_EQ(JsonParse(&Parse, json_Utf8, Content, sizeof(Content), NULL), JSON_PARSE_ERROR, TestResult);
+
+	JsonParseCleanUp(&Parse);
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+typedef struct
+{
+	size_t Allocations;
+	size_t Bytes;
+} tTestJsonParseAllocator;
+
+
+static void *TestJsonParseAllocate(void *Context, size_t Size)
+{
+	tTestJsonParseAllocator *Allocator = (tTestJsonParseAllocator *)Context;
+
+	Allocator->Allocations++;
+	Allocator->Bytes = Allocator->Bytes + Size;
+
+	return malloc(Size);
+}
+
+
+static void *TestJsonParseReallocate(void *Context, void *Memory, size_t Size, size_t NewSize)
+{
+	tTestJsonParseAllocator *Allocator = (tTestJsonParseAllocator *)Context;
+	void *NewMemory;
+
+	NewMemory = realloc(Memory, NewSize);
+	if (NewMemory != NULL)
+	{
+		Allocator->Allocations = Allocator->Allocations + ((Memory == NULL) ? 1 : 0);
+		Allocator->Bytes = Allocator->Bytes - Size + NewSize;
+	}
+
+	return NewMemory;
+}
+
+
+static void TestJsonParseFree(void *Context, void *Memory, size_t Size)
+{
+	tTestJsonParseAllocator *Allocator = (tTestJsonParseAllocator *)Context;
+
+	Allocator->Allocations--;
+	Allocator->Bytes = Allocator->Bytes - Size;
+
+	free(Memory);
+}
+
+
+static tTestResult TestJsonParseSetUpAllocator(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Content[] = "{ \"key\": \"value\", \"a longer key that needs to be allocated\": [ true, { \"key\": null } ] }";
+	tTestJsonParseAllocator Counts = { 0, 0 };
+	tJsonAllocator Allocator = { TestJsonParseAllocate, TestJsonParseReallocate, TestJsonParseFree, &Counts };
+	tJsonElement Root;
+	tJsonParse Parse;
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	for (n = 0; n < 2; n++)
+	{
+		JsonParseSetUpAllocator(&Parse, false, &Root, &Allocator);
+
+		TEST_IS_EQ(JsonParse(&Parse, json_Utf8, Content, sizeof(Content), NULL), JSON_PARSE_COMPLETE, TestResult);
+
+		TEST_IS_NOT_ZERO(Counts.Allocations, TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a longer key that needs to be allocated[/key:null]"), false), TestResult);
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key2:\"a value that is added to the parsed elements\""), true), TestResult);
+
+		JsonParseCleanUp(&Parse);
+	}
+
+	JsonElementClear(&Root);
+
+	TEST_IS_ZERO(Counts.Allocations, TestResult);
+	TEST_IS_ZERO(Counts.Bytes, TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
 static const tTestCase TestCaseJsonParse[] =
 {
 	{ "JsonParseContent",              TestJsonParseContent              },
@@ -704,6 +1125,12 @@ static const tTestCase TestCaseJsonParse[] =
 	{ "JsonParseCommentBlockInvalid",  TestJsonParseCommentBlockInvalid  },
 	{ "JsonParseLiteralValid",         TestJsonParseLiteralValid         },
 	{ "JsonParseLiteralInvalid",       TestJsonParseLiteralInvalid       },
+	{ "JsonParseUtf8Span",             TestJsonParseUtf8Span             },
+	{ "JsonParseSetUpView",            TestJsonParseSetUpView            },
+	{ "JsonParseSetUpCallback",        TestJsonParseSetUpCallback        },
+	{ "JsonParseSetUpAllocator",       TestJsonParseSetUpAllocator       },
+	{ "JsonParseUtf8",                 TestJsonParseUtf8                 },
+	{ "JsonParseUtf8Partial",          TestJsonParseUtf8Partial          },
 };
 
 
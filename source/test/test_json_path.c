@@ -1,3 +1,4 @@
+#include <stdint.h>
 #include <string.h>
 #include "json_utf16.h"
 #include "json_path.h"
@@ -733,6 +734,24 @@ static tTestResult TestJsonPathCompareString(void)
 		TEST_IS_FALSE(JsonPathCompareString(JsonPathLeft(JsonPathAscii(Paths[n]), PathLength + 1), &String), TestResult);
 	}
 
+	JsonStringClear(&String);
+
+	TEST_IS_TRUE(JsonPathCompareString(JsonPathAscii(""), &String), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompareString(JsonPathAscii("a"), &String), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddBytes(&String, (const uint8_t *)"a/b\xE2\x82\xAC", 6), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompareString(JsonPathAscii("a/b\xE2\x82\xAC"), &String), TestResult);
+
+	TEST_IS_TRUE(JsonPathCompareString(JsonPathAscii("a\\/b\xE2\x82\xAC"), &String), TestResult);
+
+	TEST_IS_TRUE(JsonPathCompareString(JsonPathAscii("\\u0061\\/b\\u20AC"), &String), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompareString(JsonPathAscii("\\u0061\\/b\\u20AD"), &String), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompareString(JsonPathAscii("\\u0061\\/b"), &String), TestResult);
+
 	JsonStringCleanUp(&String);
 
 	return TestResult;
@@ -944,6 +963,127 @@ static tTestResult TestJsonPathGetComponent(void)
 }
 
 
+static tTestResult TestJsonPathGetPosition(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const struct
+	{
+		const char *Component;
+		bool        IsPosition;
+		ptrdiff_t   Position;
+	} TestComponents[] =
+	{
+		{ "#0",                     true,  0                 },
+		{ "#3",                     true,  3                 },
+		{ "#-1",                    true,  -1                },
+		{ "#-42",                   true,  -42               },
+		{ "#9223372036854775807",   true,  PTRDIFF_MAX       },
+		{ "#-9223372036854775808",  true,  PTRDIFF_MIN       },
+		{ "#9223372036854775808",   false, 0                 },
+		{ "#-9223372036854775809",  false, 0                 },
+		{ "#",                      false, 0                 },
+		{ "#-",                     false, 0                 },
+		{ "#-0",                    false, 0                 },
+		{ "#1a",                    false, 0                 },
+		{ "# 1",                    false, 0                 },
+		{ "3",                      false, 0                 },
+		{ "/key:3",                 false, 0                 },
+		{ "\\#3",                 false, 0                 },
+		{ "",                       false, 0                 }
+	};
+	ptrdiff_t Position;
+	size_t n;
+
+	for (n = 0; n < sizeof(TestComponents) / sizeof(TestComponents[0]); n++)
+	{
+		Position = 0;
+		TEST_IS_EQ(JsonPathGetPosition(JsonPathAscii(TestComponents[n].Component), &Position), TestComponents[n].IsPosition, TestResult);
+		TEST_IS_EQ(Position, TestComponents[n].Position, TestResult);
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonPathCompile(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const struct
+	{
+		tJsonType   Type;
+		const char *Name;
+		size_t      Count;
+	} Components[] =
+	{
+		{ json_TypeObject,       "",             0 },
+		{ json_TypeKey,          "key1",         0 },
+		{ json_TypeArray,        "",             3 },
+		{ json_TypeObject,       "",             0 },
+		{ json_TypeKey,          "object",       0 },
+		{ json_TypeValueString,  "ab",           0 },
+		{ json_TypeObject,       "",             0 },
+		{ json_TypeKey,          "key/2",        0 },
+		{ json_TypeValueLiteral, "123",          0 }
+	};
+	tJsonCompiledPath CompiledPath;
+	tJsonString String;
+	size_t n;
+
+	TEST_IS_TRUE(JsonPathCompile(JsonPathAscii("/key1[ /object:\"a\\u0062\" ] / \"key\\/2\":123"), &CompiledPath), TestResult);
+
+	TEST_IS_EQ(CompiledPath.Count, sizeof(Components) / sizeof(Components[0]), TestResult);
+
+	JsonStringSetUp(&String);
+
+	for (n = 0; (n < CompiledPath.Count) && (n < sizeof(Components) / sizeof(Components[0])); n++)
+	{
+		TEST_IS_EQ(CompiledPath.Component[n].Type, Components[n].Type, TestResult);
+		TEST_IS_EQ(CompiledPath.Component[n].Length, strlen(Components[n].Name), TestResult);
+		TEST_IS_ZERO(memcmp(&CompiledPath.Names[CompiledPath.Component[n].Offset], Components[n].Name, strlen(Components[n].Name)), TestResult);
+		TEST_IS_EQ(CompiledPath.Component[n].Count, Components[n].Count, TestResult);
+
+		JsonStringClear(&String);
+		if (strlen(Components[n].Name) != 0)
+		{
+			TEST_IS_TRUE(JsonStringAddBytes(&String, (const uint8_t *)Components[n].Name, strlen(Components[n].Name)), TestResult);
+		}
+		TEST_IS_EQ(CompiledPath.Component[n].Hash, JsonStringGetHash(&String), TestResult);
+	}
+
+	JsonStringCleanUp(&String);
+
+	JsonPathCleanUpCompiled(&CompiledPath);
+
+	TEST_IS_EQ(CompiledPath.Count, 0, TestResult);
+
+	TEST_IS_NULL(CompiledPath.Component, TestResult);
+
+	TEST_IS_TRUE(JsonPathCompile(JsonPathAscii("/key[#-2][ #1 ]"), &CompiledPath), TestResult);
+
+	TEST_IS_EQ(CompiledPath.Count, 4, TestResult);
+
+	TEST_IS_TRUE((CompiledPath.Count == 4) && CompiledPath.Component[2].IsPosition && (CompiledPath.Component[2].Position == -2) && (CompiledPath.Component[2].Count == 0), TestResult);
+
+	TEST_IS_TRUE((CompiledPath.Count == 4) && CompiledPath.Component[3].IsPosition && (CompiledPath.Component[3].Position == 1), TestResult);
+
+	TEST_IS_TRUE((CompiledPath.Count == 4) && !CompiledPath.Component[1].IsPosition, TestResult);
+
+	JsonPathCleanUpCompiled(&CompiledPath);
+
+	TEST_IS_FALSE(JsonPathCompile(JsonPathAscii(""), &CompiledPath), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompile(JsonPathAscii("/key[/array"), &CompiledPath), TestResult);
+
+	TEST_IS_FALSE(JsonPathCompile(JsonPathAscii("/key:\\u00"), &CompiledPath), TestResult);
+
+	TEST_IS_EQ(CompiledPath.Count, 0, TestResult);
+
+	JsonPathCleanUpCompiled(&CompiledPath);
+
+	return TestResult;
+}
+
+
 static const tTestCase TestCaseJsonPath[] =
 {
 	{ "JsonPathUtf8",                 TestJsonPathUtf8                 },
@@ -955,7 +1095,9 @@ static const tTestCase TestCaseJsonPath[] =
 	{ "JsonPathGetPreviousCharacter", TestJsonPathGetPreviousCharacter },
 	{ "JsonPathGetString",            TestJsonPathGetString            },
 	{ "JsonPathCompareString",        TestJsonPathCompareString        },
-	{ "JsonPathGetComponent",         TestJsonPathGetComponent         }
+	{ "JsonPathGetComponent",         TestJsonPathGetComponent         },
+	{ "JsonPathGetPosition",          TestJsonPathGetPosition          },
+	{ "JsonPathCompile",              TestJsonPathCompile              }
 };
 
 
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "json.h"
+#include "test_json.h"
+
+
+#define TEST_JSON_RECORD_MAX_COUNT 16
+
+
+typedef struct
+{
+	tJsonElement Expected[TEST_JSON_RECORD_MAX_COUNT];
+	size_t       ExpectedCount;
+	size_t       Count;
+	size_t       Invalid;
+	size_t       StopIndex;
+	bool         Ordered;
+	bool         ok;
+} tTestJsonRecordContext;
+
+
+static bool TestJsonRecordCompare(void *Context, size_t Index, tJsonElement *Root)
+{
+	tTestJsonRecordContext *Record = (tTestJsonRecordContext *)Context;
+
+	if ((Index != Record->Count) || (Index >= Record->ExpectedCount))
+	{
+		Record->ok = false;
+	}
+	else if (Root == NULL)
+	{
+		Record->ok = Record->ok && (Record->Expected[Index].Child == NULL);
+		Record->Invalid++;
+	}
+	else
+	{
+		Record->ok = Record->ok && TestJsonIsEqual(Root, &Record->Expected[Index]);
+	}
+
+	Record->Count++;
+
+	return Record->Count != Record->StopIndex;
+}
+
+
+static bool TestJsonRecordId(void *Context, size_t Index, tJsonElement *Root)
+{
+	tTestJsonRecordContext *Record = (tTestJsonRecordContext *)Context;
+	tJsonElement *Element;
+	char Id[32];
+
+	Element = (Root != NULL) ? JsonElementFind(Root, JsonPathAscii((Index % 3 == 0) ? "/id" : "[#1]/id"), false) : NULL;
+	Element = (Element != NULL) ? JsonElementGetChild(Element, true) : NULL;
+
+	snprintf(Id, sizeof(Id), "%zu", Index);
+
+	if ((Element == NULL) || (Element->Name.Length != strlen(Id)) || (memcmp(Element->Name.Content, Id, Element->Name.Length) != 0))
+	{
+		Record->ok = false;
+	}
+	else if (Record->Ordered && (Index != Record->Count))
+	{
+		Record->ok = false;
+	}
+
+	Record->Count++;
+
+	return true;
+}
+
+
+static bool TestJsonRecordFeed(void *Context, const uint8_t *Content, size_t Length, size_t *Offset)
+{
+	if (!JsonRecordRead((tJsonRecordParse *)Context, Content, Length))
+	{
+		return false;
+	}
+
+	*Offset = Length;
+
+	return true;
+}
+
+
+static bool TestJsonRecordRead(tTestJsonRecordContext *Record, const char *Content, const char *Expected[], size_t ExpectedCount, size_t ThreadCount, size_t ChunkLength, bool StripComments)
+{
+	tJsonRecordParse Parse;
+	size_t Length = strlen(Content);
+	size_t n;
+	bool ok;
+
+	Record->ExpectedCount = ExpectedCount;
+	Record->Count = 0;
+	Record->Invalid = 0;
+	Record->ok = true;
+
+	for (n = 0; n < ExpectedCount; n++)
+	{
+		JsonElementSetUp(&Record->Expected[n]);
+		if ((Expected[n] != NULL) && !JsonReadStringAscii(&Record->Expected[n], StripComments, Expected[n]))
+		{
+			Record->ok = false;
+		}
+	}
+
+	ok = JsonRecordSetUp(&Parse, ThreadCount, StripComments, false, TestJsonRecordCompare, Record) &&
+	     (TestJsonFeed(Content, Length, ChunkLength, TestJsonRecordFeed, &Parse) == Length) &&
+	     JsonRecordFinish(&Parse);
+
+	JsonRecordCleanUp(&Parse);
+
+	for (n = 0; n < ExpectedCount; n++)
+	{
+		JsonElementCleanUp(&Record->Expected[n]);
+	}
+
+	return ok;
+}
+
+
+static char *TestJsonRecordLines(size_t Count, size_t *Length)
+{
+	char *Content;
+	size_t n;
+
+	Content = (char *)malloc(Count * 64 + 1);
+	if (Content != NULL)
+	{
+		for (*Length = 0, n = 0; n < Count; n++)
+		{
+			*Length = *Length + (size_t)sprintf(&Content[*Length], (n % 3 == 0) ? "{\"id\":%zu,\"v\":\"a\\\"}\"}\n" : "[1,{\"id\":%zu}]\n", n);
+		}
+	}
+
+	return Content;
+}
+
+
+static tTestResult TestJsonRecordSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonRecordParse Parse;
+
+	TEST_IS_TRUE(JsonRecordSetUp(&Parse, 2, true, false, TestJsonRecordCompare, NULL), TestResult);
+	TEST_IS_EQ(Parse.ThreadCount, 2, TestResult);
+	TEST_IS_EQ(Parse.BatchCount, 3 * JSON_RECORD_BATCHES_PER_THREAD, TestResult);
+	TEST_IS_NULL(Parse.Filling, TestResult);
+	TEST_IS_FALSE(Parse.Stopped, TestResult);
+
+	TEST_IS_TRUE(JsonRecordFinish(&Parse), TestResult);
+
+	JsonRecordCleanUp(&Parse);
+
+	TEST_IS_NULL(Parse.Batch, TestResult);
+	TEST_IS_NULL(Parse.Thread, TestResult);
+	TEST_IS_ZERO(Parse.ThreadCount, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecordValues(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content =
+		"{\"a\":1}\n"
+		"[ 1, \"]\", { \"b\" : [] } ]\n"
+		"  \"string \\\" }\"  "
+		"{}[]\"x\""
+		"123 true\tnull\n"
+		"-1.5e3\n"
+		"{\n"
+		"  \"pretty\" : {\n"
+		"    \"list\" : [ 1, 2 ]\n"
+		"  }\n"
+		"}";
+	static const char *Expected[] =
+	{
+		"{\"a\":1}",
+		"[ 1, \"]\", { \"b\" : [] } ]",
+		"\"string \\\" }\"",
+		"{}",
+		"[]",
+		"\"x\"",
+		"123",
+		"true",
+		"null",
+		"-1.5e3",
+		"{ \"pretty\" : { \"list\" : [ 1, 2 ] } }"
+	};
+	size_t ChunkLength[] = { 1, 2, 7, 4096 };
+	size_t ThreadCount[] = { 0, 1, 4 };
+	tTestJsonRecordContext Record;
+	size_t n;
+	size_t m;
+
+	Record.StopIndex = 0;
+
+	for (n = 0; n < sizeof(ChunkLength) / sizeof(ChunkLength[0]); n++)
+	{
+		for (m = 0; m < sizeof(ThreadCount) / sizeof(ThreadCount[0]); m++)
+		{
+			TEST_IS_TRUE(TestJsonRecordRead(&Record, Content, Expected, sizeof(Expected) / sizeof(Expected[0]), ThreadCount[m], ChunkLength[n], true), TestResult);
+			TEST_IS_TRUE(Record.ok, TestResult);
+			TEST_IS_EQ(Record.Count, sizeof(Expected) / sizeof(Expected[0]), TestResult);
+			TEST_IS_ZERO(Record.Invalid, TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecordComments(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content =
+		"// first\n"
+		"{ \"a\" : /* inner */ 1 }\n"
+		"/* second */ [ 2 // inner\n"
+		"] /* trailing */\n"
+		"3/* after literal */\n"
+		"// end";
+	static const char *Expected[] =
+	{
+		"// first\n{ \"a\" : /* inner */ 1 }",
+		"/* second */ [ 2 // inner\n]",
+		"/* trailing */\n3"
+	};
+	static const char *ContentReturn = "{\"a\":1 // return\r}\r{\"b\":2}\r\n{\"c\":3}";
+	static const char *ExpectedReturn[] =
+	{
+		"{\"a\":1}",
+		"{\"b\":2}",
+		"{\"c\":3}"
+	};
+	size_t ChunkLength[] = { 1, 3, 4096 };
+	tTestJsonRecordContext Record;
+	size_t n;
+
+	Record.StopIndex = 0;
+
+	for (n = 0; n < sizeof(ChunkLength) / sizeof(ChunkLength[0]); n++)
+	{
+		TEST_IS_TRUE(TestJsonRecordRead(&Record, Content, Expected, sizeof(Expected) / sizeof(Expected[0]), 2, ChunkLength[n], true), TestResult);
+		TEST_IS_TRUE(Record.ok, TestResult);
+		TEST_IS_EQ(Record.Count, 3, TestResult);
+
+		TEST_IS_TRUE(TestJsonRecordRead(&Record, ContentReturn, ExpectedReturn, sizeof(ExpectedReturn) / sizeof(ExpectedReturn[0]), 2, ChunkLength[n], true), TestResult);
+		TEST_IS_TRUE(Record.ok, TestResult);
+		TEST_IS_EQ(Record.Count, 3, TestResult);
+		TEST_IS_ZERO(Record.Invalid, TestResult);
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecordInvalid(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content =
+		"{\"a\":1}\n"
+		"{\"a\":}\n"
+		"]\n"
+		"[1,2}\n"
+		"{\"b\":2}\n"
+		"[\"unterminated";
+	static const char *Expected[] =
+	{
+		"{\"a\":1}",
+		NULL,
+		NULL,
+		NULL,
+		"{\"b\":2}",
+		NULL
+	};
+	size_t ChunkLength[] = { 1, 4096 };
+	tTestJsonRecordContext Record;
+	size_t n;
+
+	Record.StopIndex = 0;
+
+	for (n = 0; n < sizeof(ChunkLength) / sizeof(ChunkLength[0]); n++)
+	{
+		TEST_IS_TRUE(TestJsonRecordRead(&Record, Content, Expected, sizeof(Expected) / sizeof(Expected[0]), 3, ChunkLength[n], true), TestResult);
+		TEST_IS_TRUE(Record.ok, TestResult);
+		TEST_IS_EQ(Record.Count, 6, TestResult);
+		TEST_IS_EQ(Record.Invalid, 4, TestResult);
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecordStop(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Content = "1 2 3 4 5 6";
+	static const char *Expected[] = { "1", "2", "3", "4", "5", "6" };
+	tTestJsonRecordContext Record;
+
+	Record.StopIndex = 3;
+
+	TEST_IS_FALSE(TestJsonRecordRead(&Record, Content, Expected, 6, 2, 1, true), TestResult);
+	TEST_IS_TRUE(Record.ok, TestResult);
+	TEST_IS_EQ(Record.Count, 3, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecordBatches(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tTestJsonRecordContext Record;
+	tJsonRecordParse Parse;
+	size_t ThreadCount[] = { 0, 1, 4 };
+	size_t Count = 20000;
+	size_t Length = 0;
+	size_t Offset;
+	size_t n;
+	char *Content;
+
+	Content = TestJsonRecordLines(Count, &Length);
+
+	TEST_IS_NOT_NULL(Content, TestResult);
+	TEST_IS_TRUE(Length > 4 * JSON_RECORD_BATCH_SIZE, TestResult);
+
+	for (n = 0; (Content != NULL) && (n < 2 * sizeof(ThreadCount) / sizeof(ThreadCount[0])); n++)
+	{
+		Record.Count = 0;
+		Record.Ordered = (n % 2 == 0);
+		Record.ok = true;
+
+		TEST_IS_TRUE(JsonRecordSetUp(&Parse, ThreadCount[n / 2], false, !Record.Ordered, TestJsonRecordId, &Record), TestResult);
+
+		for (Offset = 0; Offset < Length; Offset = Offset + 1000)
+		{
+			TEST_IS_TRUE(JsonRecordRead(&Parse, (const uint8_t *)&Content[Offset], (Length - Offset < 1000) ? Length - Offset : 1000), TestResult);
+		}
+
+		TEST_IS_TRUE(JsonRecordFinish(&Parse), TestResult);
+
+		JsonRecordCleanUp(&Parse);
+
+		TEST_IS_TRUE(Record.ok, TestResult);
+		TEST_IS_EQ(Record.Count, Count, TestResult);
+	}
+
+	TEST_IS_TRUE(JsonRecordSetUp(&Parse, 2, false, false, TestJsonRecordId, &Record), TestResult);
+	TEST_IS_TRUE(JsonRecordRead(&Parse, (const uint8_t *)Content, Length), TestResult);
+
+	JsonRecordCleanUp(&Parse);
+
+	free(Content);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonRecord[] =
+{
+	{ "JsonRecordSetUp",    TestJsonRecordSetUp    },
+	{ "JsonRecordValues",   TestJsonRecordValues   },
+	{ "JsonRecordComments", TestJsonRecordComments },
+	{ "JsonRecordInvalid",  TestJsonRecordInvalid  },
+	{ "JsonRecordStop",     TestJsonRecordStop     },
+	{ "JsonRecordBatches",  TestJsonRecordBatches  }
+};
+
+
+const tTest TestJsonRecord =
+{
+	"JsonRecord",
+	TestCaseJsonRecord,
+	sizeof(TestCaseJsonRecord) / sizeof(TestCaseJsonRecord[0])
+};
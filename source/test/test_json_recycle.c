@@ -0,0 +1,211 @@
+#include <string.h>
+#include "json.h"
+#include "json_recycle.h"
+#include "test_json.h"
+
+
+static tTestResult TestJsonRecycleSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonRecycle Recycle;
+	size_t Class;
+
+	JsonRecycleSetUp(&Recycle);
+
+	for (Class = 0; Class < JSON_RECYCLE_CLASS_COUNT; Class++)
+	{
+		TEST_IS_NULL(Recycle.Block[Class], TestResult);
+	}
+
+	TEST_IS_ZERO(Recycle.Count, TestResult);
+
+	JsonRecycleCleanUp(&Recycle);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecycleClear(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonRecycle Recycle;
+	void *Memory[10];
+	size_t n;
+
+	JsonRecycleSetUp(&Recycle);
+
+	for (n = 0; n < 10; n++)
+	{
+		Memory[n] = JsonRecycleAllocate(&Recycle, 8 * n + 1);
+		TEST_IS_NOT_NULL(Memory[n], TestResult);
+	}
+
+	TEST_IS_EQ(Recycle.Count, 10, TestResult);
+
+	for (n = 0; n < 10; n++)
+	{
+		JsonRecycleFree(&Recycle, Memory[n], 8 * n + 1);
+	}
+
+	TEST_IS_EQ(Recycle.Count, 10, TestResult);
+
+	JsonRecycleClear(&Recycle);
+
+	TEST_IS_ZERO(Recycle.Count, TestResult);
+
+	TEST_IS_NULL(Recycle.Block[0], TestResult);
+
+	JsonRecycleCleanUp(&Recycle);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecycleAllocate(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonRecycle Recycle;
+	void *Memory;
+	void *Other;
+	size_t Class;
+	size_t Size;
+
+	JsonRecycleSetUp(&Recycle);
+
+	TEST_IS_NULL(JsonRecycleAllocate(&Recycle, 0), TestResult);
+
+	for (Class = 0; Class < JSON_RECYCLE_CLASS_COUNT; Class++)
+	{
+		if (Class < JSON_RECYCLE_SMALL_CLASS_COUNT)
+		{
+			Size = (Class + 1) * JSON_RECYCLE_CLASS_SIZE - Class % JSON_RECYCLE_CLASS_SIZE;
+		}
+		else
+		{
+			Size = (JSON_RECYCLE_CLASS_SIZE * JSON_RECYCLE_SMALL_CLASS_COUNT << (Class - JSON_RECYCLE_SMALL_CLASS_COUNT)) + 1 + Class;
+		}
+		Memory = JsonRecycleAllocate(&Recycle, Size);
+		TEST_IS_NOT_NULL(Memory, TestResult);
+		memset(Memory, 0xAA, Size);
+		JsonRecycleFree(&Recycle, Memory, Size);
+
+		Other = JsonRecycleAllocate(&Recycle, Size);
+		TEST_IS_TRUE(Other == Memory, TestResult);
+		JsonRecycleFree(&Recycle, Other, Size);
+	}
+
+	TEST_IS_EQ(Recycle.Count, JSON_RECYCLE_CLASS_COUNT, TestResult);
+
+	Memory = JsonRecycleAllocate(&Recycle, JSON_RECYCLE_MAX_SIZE + 1);
+	TEST_IS_NOT_NULL(Memory, TestResult);
+	TEST_IS_EQ(Recycle.Count, JSON_RECYCLE_CLASS_COUNT + 1, TestResult);
+	JsonRecycleFree(&Recycle, Memory, JSON_RECYCLE_MAX_SIZE + 1);
+	TEST_IS_EQ(Recycle.Count, JSON_RECYCLE_CLASS_COUNT, TestResult);
+
+	JsonRecycleCleanUp(&Recycle);
+
+	TEST_IS_ZERO(Recycle.Count, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecycleReallocate(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonRecycle Recycle;
+	uint8_t *Memory;
+	uint8_t *NewMemory;
+
+	JsonRecycleSetUp(&Recycle);
+
+	Memory = (uint8_t *)JsonRecycleReallocate(&Recycle, NULL, 0, 10);
+	TEST_IS_NOT_NULL(Memory, TestResult);
+	memcpy(Memory, "123456789", 10);
+
+	NewMemory = (uint8_t *)JsonRecycleReallocate(&Recycle, Memory, 10, JSON_RECYCLE_CLASS_SIZE);
+	TEST_IS_TRUE(NewMemory == Memory, TestResult);
+
+	NewMemory = (uint8_t *)JsonRecycleReallocate(&Recycle, Memory, JSON_RECYCLE_CLASS_SIZE, 1000);
+	TEST_IS_NOT_NULL(NewMemory, TestResult);
+	TEST_IS_TRUE(NewMemory != Memory, TestResult);
+	TEST_IS_ZERO(memcmp(NewMemory, "123456789", 10), TestResult);
+	TEST_IS_TRUE(Recycle.Block[0] == (tJsonRecycleBlock *)Memory, TestResult);
+
+	Memory = (uint8_t *)JsonRecycleReallocate(&Recycle, NewMemory, 1000, 1024);
+	TEST_IS_TRUE(Memory == NewMemory, TestResult);
+
+	Memory = (uint8_t *)JsonRecycleReallocate(&Recycle, Memory, 1024, 100000);
+	TEST_IS_NOT_NULL(Memory, TestResult);
+	TEST_IS_ZERO(memcmp(Memory, "123456789", 10), TestResult);
+
+	NewMemory = (uint8_t *)JsonRecycleReallocate(&Recycle, Memory, 100000, 200000);
+	TEST_IS_NOT_NULL(NewMemory, TestResult);
+	TEST_IS_ZERO(memcmp(NewMemory, "123456789", 10), TestResult);
+
+	JsonRecycleFree(&Recycle, NewMemory, 200000);
+
+	JsonRecycleCleanUp(&Recycle);
+
+	TEST_IS_ZERO(Recycle.Count, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonRecycleGetAllocator(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char Content[] = "{ \"key1\" : [ \"value1\", true, { \"key2\" : null } ], \"a longer key that is not stored inline\" : \"a longer value that is not stored inline\" }";
+	tJsonRecycle Recycle;
+	tJsonAllocator Allocator;
+	tJsonElement Root;
+	size_t Count;
+	size_t n;
+
+	JsonRecycleSetUp(&Recycle);
+	JsonRecycleGetAllocator(&Recycle, &Allocator);
+	JsonElementSetUpAllocator(&Root, &Allocator);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, Content), TestResult);
+
+	Count = Recycle.Count;
+	TEST_IS_NOT_ZERO(Count, TestResult);
+
+	for (n = 0; n < 3; n++)
+	{
+		TEST_IS_TRUE(JsonReadStringAscii(&Root, false, Content), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key1[/key2:null]"), false), TestResult);
+
+		TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/a longer key that is not stored inline:\"a longer value that is not stored inline\""), false), TestResult);
+
+		TEST_IS_EQ(Recycle.Count, Count, TestResult);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	JsonRecycleCleanUp(&Recycle);
+
+	TEST_IS_ZERO(Recycle.Count, TestResult);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonRecycle[] =
+{
+	{ "JsonRecycleSetUp",        TestJsonRecycleSetUp        },
+	{ "JsonRecycleClear",        TestJsonRecycleClear        },
+	{ "JsonRecycleAllocate",     TestJsonRecycleAllocate     },
+	{ "JsonRecycleReallocate",   TestJsonRecycleReallocate   },
+	{ "JsonRecycleGetAllocator", TestJsonRecycleGetAllocator }
+};
+
+
+const tTest TestJsonRecycle =
+{
+	"JsonRecycle",
+	TestCaseJsonRecycle,
+	sizeof(TestCaseJsonRecycle) / sizeof(TestCaseJsonRecycle[0])
+};
@@ -0,0 +1,134 @@
+#include <string.h>
+#include "json_scan.h"
+#include "test_json.h"
+
+
+static size_t TestJsonScanReference(const uint8_t *Content, size_t Length, const char *Stop, bool StopNonAscii)
+{
+	size_t n;
+
+	for (n = 0; n < Length; n++)
+	{
+		if ((Content[n] == '\0') || (strchr(Stop, Content[n]) != NULL) || (StopNonAscii && ((Content[n] < 0x20) || (Content[n] >= 0x80))))
+		{
+			break;
+		}
+	}
+
+	return n;
+}
+
+
+static size_t TestJsonScanWhitespaceReference(const uint8_t *Content, size_t Length)
+{
+	size_t n;
+
+	for (n = 0; (n < Length) && ((Content[n] == ' ') || (Content[n] == '\t') || (Content[n] == '\r') || (Content[n] == '\n')); n++)
+		;
+
+	return n;
+}
+
+
+static tTestResult TestJsonScanString(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Stop[] = { '"', '\\', '\0', '\x1F', '\t', '\x80', '\xFF' };
+	uint8_t Content[100];
+	size_t Offset;
+	size_t n;
+
+	TEST_IS_EQ(JsonScanString((const uint8_t *)"", 0), 0, TestResult);
+
+	for (n = 0; n < sizeof(Stop); n++)
+	{
+		for (Offset = 0; Offset < sizeof(Content); Offset++)
+		{
+			memset(Content, 'a', sizeof(Content));
+			Content[Offset] = Stop[n];
+			TEST_IS_EQ(JsonScanString(Content, sizeof(Content)), Offset, TestResult);
+			TEST_IS_EQ(JsonScanString(Content, Offset), Offset, TestResult);
+			TEST_IS_EQ(JsonScanString(&Content[Offset / 2], sizeof(Content) - Offset / 2), TestJsonScanReference(&Content[Offset / 2], sizeof(Content) - Offset / 2, "\"\\", true), TestResult);
+		}
+	}
+
+	TEST_IS_EQ(JsonScanString((const uint8_t *)"abcdefghijklmnopqrstuvwxyz*/ {}[]:,0123456789 abcdefghijklmnopqrstuvwxyz\"", 73), 72, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonScanComment(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Stop[] = { '*', '\0', '\r', '\n', '\t', '\x80', '\xFF' };
+	uint8_t Content[100];
+	size_t Offset;
+	size_t n;
+
+	TEST_IS_EQ(JsonScanComment((const uint8_t *)"", 0), 0, TestResult);
+
+	for (n = 0; n < sizeof(Stop); n++)
+	{
+		for (Offset = 0; Offset < sizeof(Content); Offset++)
+		{
+			memset(Content, '"', sizeof(Content));
+			Content[Offset] = Stop[n];
+			TEST_IS_EQ(JsonScanComment(Content, sizeof(Content)), Offset, TestResult);
+			TEST_IS_EQ(JsonScanComment(Content, Offset), Offset, TestResult);
+			TEST_IS_EQ(JsonScanComment(&Content[Offset / 2], sizeof(Content) - Offset / 2), TestJsonScanReference(&Content[Offset / 2], sizeof(Content) - Offset / 2, "*", true), TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonScanWhitespace(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Whitespace[] = { ' ', '\t', '\r', '\n' };
+	static const uint8_t Stop[] = { '\0', '"', '{', '\x0B', '\x0C', '\x80', '\xFF' };
+	uint8_t Content[100];
+	size_t Offset;
+	size_t n;
+
+	TEST_IS_EQ(JsonScanWhitespace((const uint8_t *)"", 0), 0, TestResult);
+
+	for (n = 0; n < sizeof(Content); n++)
+	{
+		Content[n] = Whitespace[n % sizeof(Whitespace)];
+	}
+
+	TEST_IS_EQ(JsonScanWhitespace(Content, sizeof(Content)), sizeof(Content), TestResult);
+
+	for (n = 0; n < sizeof(Stop); n++)
+	{
+		for (Offset = 0; Offset < sizeof(Content); Offset++)
+		{
+			memset(Content, ' ', sizeof(Content));
+			Content[Offset] = Stop[n];
+			TEST_IS_EQ(JsonScanWhitespace(Content, sizeof(Content)), Offset, TestResult);
+			TEST_IS_EQ(JsonScanWhitespace(Content, Offset), Offset, TestResult);
+			TEST_IS_EQ(JsonScanWhitespace(&Content[Offset / 2], sizeof(Content) - Offset / 2), TestJsonScanWhitespaceReference(&Content[Offset / 2], sizeof(Content) - Offset / 2), TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonScan[] =
+{
+	{ "JsonScanString",     TestJsonScanString     },
+	{ "JsonScanComment",    TestJsonScanComment    },
+	{ "JsonScanWhitespace", TestJsonScanWhitespace }
+};
+
+
+const tTest TestJsonScan =
+{
+	"JsonScan",
+	TestCaseJsonScan,
+	sizeof(TestCaseJsonScan) / sizeof(TestCaseJsonScan[0])
+};
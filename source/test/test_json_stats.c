@@ -0,0 +1,105 @@
+#include <string.h>
+#include "json_stats.h"
+#include "json.h"
+#include "test_json.h"
+
+
+static tTestResult TestJsonStatsGet(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonFormat Format;
+	tJsonStats Stats;
+	uint8_t Content[128];
+	size_t Offset = 0;
+
+	JsonElementSetUp(&Root);
+
+	JsonStatsReset();
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "{\"key\": [1, 2], \"long key name that is not stored inline\": true}"), TestResult);
+
+	TEST_IS_NOT_NULL(JsonElementFind(&Root, JsonPathAscii("/key"), false), TestResult);
+
+	JsonFormatSetUpCompress(&Format, &Root);
+
+	TEST_IS_EQ(JsonFormat(&Format, json_Utf8, Content, sizeof(Content), &Offset), JSON_FORMAT_COMPLETE, TestResult);
+
+	JsonFormatCleanUp(&Format);
+
+	JsonElementClear(&Root);
+
+	JsonStatsGet(&Stats);
+
+#ifdef JSON_STATS
+	TEST_IS_EQ(Stats.Allocation[json_StatsElement].Malloc, 7, TestResult);
+
+	TEST_IS_EQ(Stats.Allocation[json_StatsElement].Free, 7, TestResult);
+
+	TEST_IS_EQ(Stats.Allocation[json_StatsElement].Bytes, 7 * sizeof(tJsonElement), TestResult);
+
+	TEST_IS_NOT_EQ(Stats.Allocation[json_StatsString].Malloc + Stats.Allocation[json_StatsString].Realloc, 0, TestResult);
+
+	TEST_IS_EQ(Stats.Allocation[json_StatsString].Free, 1, TestResult);
+
+	TEST_IS_ZERO(Stats.Allocation[json_StatsPath].Malloc, TestResult);
+
+	TEST_IS_EQ(Stats.Time[json_StatsParse].Calls, 1, TestResult);
+
+	TEST_IS_EQ(Stats.Time[json_StatsFormat].Calls, 1, TestResult);
+
+	TEST_IS_EQ(Stats.Time[json_StatsFind].Calls, 1, TestResult);
+#else
+	TEST_IS_ZERO(Stats.Allocation[json_StatsElement].Malloc, TestResult);
+
+	TEST_IS_ZERO(Stats.Allocation[json_StatsString].Bytes, TestResult);
+
+	TEST_IS_ZERO(Stats.Time[json_StatsParse].Calls, TestResult);
+
+	TEST_IS_ZERO(Stats.Time[json_StatsFind].Nanoseconds, TestResult);
+#endif
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStatsReset(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonStats Stats;
+	tJsonStats ZeroStats;
+
+	memset(&ZeroStats, 0, sizeof(ZeroStats));
+
+	JsonElementSetUp(&Root);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "[1, 2, 3]"), TestResult);
+
+	JsonElementCleanUp(&Root);
+
+	JsonStatsReset();
+
+	JsonStatsGet(&Stats);
+
+	TEST_IS_ZERO(memcmp(&Stats, &ZeroStats, sizeof(Stats)), TestResult);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonStats[] =
+{
+	{ "JsonStatsGet",   TestJsonStatsGet   },
+	{ "JsonStatsReset", TestJsonStatsReset }
+};
+
+
+const tTest TestJsonStats =
+{
+	"JsonStats",
+	TestCaseJsonStats,
+	sizeof(TestCaseJsonStats) / sizeof(TestCaseJsonStats[0])
+};
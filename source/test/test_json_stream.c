@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <string.h>
+#include "json.h"
+#include "test_json.h"
+
+
+#define TEST_JSON_STREAM_CONTENT "{ \"a\" : [ 1, \"x\\ty\", { \"b\" : null } ], // c1\n \"c\" : { /* c2\n c3 */ \"d\" : [ [ ] , { } ] }, \"e\" : \"\\u00e9\" }"
+#define TEST_JSON_STREAM_SIZE    1024
+#define TEST_JSON_STREAM_KEYS    1000
+
+
+typedef struct
+{
+	tJsonStream Stream;
+	char       *Output;
+	size_t      Size;
+	size_t      OutputOffset;
+	size_t     *MaxCount;
+	int         ParseState;
+	int         State;
+} tTestJsonStreamRead;
+
+
+static size_t TestJsonStreamWrite(const char *Content, size_t IndentSize, tJsonCommentType CommentType, char *Output, size_t Size)
+{
+	tJsonElement Root;
+	tJsonFormat Format;
+	size_t Offset = 0;
+
+	JsonElementSetUp(&Root);
+
+	if (JsonReadStringAscii(&Root, CommentType == json_CommentNone, Content))
+	{
+		if (IndentSize == 0)
+		{
+			JsonFormatSetUpSpace(&Format, &Root);
+		}
+		else
+		{
+			JsonFormatSetUpIndent(&Format, IndentSize, CommentType, &Root);
+		}
+
+		if (JsonFormat(&Format, json_Utf8, (uint8_t *)Output, Size, &Offset) != JSON_FORMAT_COMPLETE)
+		{
+			Offset = 0;
+		}
+
+		JsonFormatCleanUp(&Format);
+	}
+
+	JsonElementCleanUp(&Root);
+
+	Output[Offset] = '\0';
+
+	return Offset;
+}
+
+
+static bool TestJsonStreamFeed(void *Context, const uint8_t *Content, size_t Length, size_t *Offset)
+{
+	tTestJsonStreamRead *Read = (tTestJsonStreamRead *)Context;
+	size_t Count;
+
+	Read->ParseState = JsonStreamParse(&Read->Stream, json_Utf8, Content, Length, Offset);
+
+	if ((Read->MaxCount != NULL) && ((Count = TestJsonCount(Read->Stream.Root.Child)) > *Read->MaxCount))
+	{
+		*Read->MaxCount = Count;
+	}
+
+	Read->State = JsonStreamFormat(&Read->Stream, json_Utf8, (uint8_t *)Read->Output, Read->Size, &Read->OutputOffset);
+
+	return (Read->ParseState == JSON_STREAM_INCOMPLETE) && (Read->State == JSON_STREAM_WAITING);
+}
+
+
+static int TestJsonStreamRead(const char *Content, size_t ChunkLength, size_t IndentSize, tJsonCommentType CommentType, tJsonEdit *Edit, size_t EditCount, char *Output, size_t Size, size_t *MaxCount)
+{
+	tTestJsonStreamRead Read;
+
+	Read.Output = Output;
+	Read.Size = Size;
+	Read.OutputOffset = 0;
+	Read.MaxCount = MaxCount;
+	Read.ParseState = JSON_STREAM_INCOMPLETE;
+	Read.State = JSON_STREAM_WAITING;
+
+	JsonStreamSetUp(&Read.Stream, IndentSize, CommentType, Edit, EditCount);
+
+	if (MaxCount != NULL)
+	{
+		*MaxCount = 0;
+	}
+
+	TestJsonFeed(Content, strlen(Content) + 1, ChunkLength, TestJsonStreamFeed, &Read);
+
+	JsonStreamCleanUp(&Read.Stream);
+
+	Output[Read.OutputOffset] = '\0';
+
+	return (Read.ParseState == JSON_STREAM_ERROR) ? Read.ParseState : Read.State;
+}
+
+
+static tTestResult TestJsonStreamSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonStream Stream;
+	tJsonElement Value;
+	tJsonEdit Edit;
+
+	JsonElementSetUp(&Value);
+
+	JsonEditSetUp(&Edit, JsonPathAscii("/a"), &Value);
+
+	TEST_IS_EQ(Edit.Value, &Value, TestResult);
+	TEST_IS_NULL(Edit.Hold, TestResult);
+	TEST_IS_NULL(Edit.Wait, TestResult);
+	TEST_IS_EQ(Edit.State, json_EditPending, TestResult);
+
+	JsonStreamSetUp(&Stream, 3, json_CommentLine, &Edit, 1);
+
+	TEST_IS_EQ(Stream.Edit, &Edit, TestResult);
+	TEST_IS_EQ(Stream.EditCount, 1, TestResult);
+	TEST_IS_EQ(Stream.EditError, 1, TestResult);
+	TEST_IS_EQ(Stream.IndentSize, 3, TestResult);
+	TEST_IS_EQ(Stream.CommentType, json_CommentLine, TestResult);
+	TEST_IS_EQ(Stream.ParseState, JSON_PARSE_INCOMPLETE, TestResult);
+	TEST_IS_FALSE(Stream.Formatting, TestResult);
+	TEST_IS_NULL(Stream.Root.Child, TestResult);
+
+	JsonStreamCleanUp(&Stream);
+
+	JsonStreamSetUp(&Stream, 0, json_CommentLine, NULL, 0);
+
+	TEST_IS_EQ(Stream.CommentType, json_CommentNone, TestResult);
+
+	JsonStreamCleanUp(&Stream);
+
+	JsonElementCleanUp(&Value);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamFormat(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	const tJsonCommentType CommentType[] = { json_CommentNone, json_CommentLine, json_CommentBlock };
+	char Expected[TEST_JSON_STREAM_SIZE];
+	char Output[TEST_JSON_STREAM_SIZE];
+	size_t ChunkLength;
+	size_t IndentSize;
+	size_t Index;
+
+	for (IndentSize = 0; IndentSize <= 3; IndentSize = IndentSize + 3)
+	{
+		for (Index = 0; Index < sizeof(CommentType) / sizeof(CommentType[0]); Index++)
+		{
+			TEST_IS_NOT_ZERO(TestJsonStreamWrite(TEST_JSON_STREAM_CONTENT, IndentSize, CommentType[Index], Expected, sizeof(Expected)), TestResult);
+
+			for (ChunkLength = 1; ChunkLength <= sizeof(TEST_JSON_STREAM_CONTENT); ChunkLength++)
+			{
+				TEST_IS_EQ(TestJsonStreamRead(TEST_JSON_STREAM_CONTENT, ChunkLength, IndentSize, CommentType[Index], NULL, 0, Output, sizeof(Output), NULL), JSON_STREAM_COMPLETE, TestResult);
+				TEST_IS_ZERO(strcmp(Output, Expected), TestResult);
+			}
+		}
+	}
+
+	TEST_IS_EQ(TestJsonStreamRead("", 1, 3, json_CommentLine, NULL, 0, Output, sizeof(Output), NULL), JSON_STREAM_ERROR, TestResult);
+	TEST_IS_ZERO(strlen(Output), TestResult);
+	TEST_IS_EQ(TestJsonStreamRead("{ \"a\" : [ 1, }", 1, 3, json_CommentLine, NULL, 0, Output, sizeof(Output), NULL), JSON_STREAM_ERROR, TestResult);
+	TEST_IS_EQ(TestJsonStreamRead("{ \"a\" : [ 1, 2 ] ", 1, 3, json_CommentLine, NULL, 0, Output, sizeof(Output), NULL), JSON_STREAM_ERROR, TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamEdit(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	const char *Path[] = { "/a[/b:null]/b", "/c/d[#1]", "/c/f", "/e" };
+	const char *Value[] = { "[ 2 ]", "{ \"g\" : 1 }", "true", "{ \"h\" : 0 }" };
+	const char *Expected = "{ \"a\": [ 1, \"x\\ty\", { \"b\": [ 2 ] } ], \"c\": { \"d\": [ [], { \"g\": 1 } ], \"f\": true }, \"e\": { \"h\": 0 } }";
+	tJsonElement Element[sizeof(Path) / sizeof(Path[0])];
+	tJsonEdit Edit[sizeof(Path) / sizeof(Path[0])];
+	char Output[TEST_JSON_STREAM_SIZE];
+	size_t ChunkLength;
+	size_t Index;
+
+	for (ChunkLength = 1; ChunkLength <= sizeof(TEST_JSON_STREAM_CONTENT); ChunkLength++)
+	{
+		for (Index = 0; Index < sizeof(Path) / sizeof(Path[0]); Index++)
+		{
+			JsonElementSetUp(&Element[Index]);
+			TEST_IS_TRUE(JsonReadStringAscii(&Element[Index], true, Value[Index]), TestResult);
+			JsonEditSetUp(&Edit[Index], JsonPathAscii(Path[Index]), &Element[Index]);
+		}
+
+		TEST_IS_EQ(TestJsonStreamRead(TEST_JSON_STREAM_CONTENT, ChunkLength, 0, json_CommentNone, Edit, sizeof(Edit) / sizeof(Edit[0]), Output, sizeof(Output), NULL), JSON_STREAM_COMPLETE, TestResult);
+		TEST_IS_ZERO(strcmp(Output, Expected), TestResult);
+
+		for (Index = 0; Index < sizeof(Path) / sizeof(Path[0]); Index++)
+		{
+			TEST_IS_EQ(Edit[Index].State, json_EditApplied, TestResult);
+			JsonElementCleanUp(&Element[Index]);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamEditError(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Element;
+	tJsonEdit Edit;
+	char Output[TEST_JSON_STREAM_SIZE];
+
+	JsonElementSetUp(&Element);
+	TEST_IS_TRUE(JsonReadStringAscii(&Element, true, "1"), TestResult);
+
+	JsonEditSetUp(&Edit, JsonPathAscii("/a[#0]/b"), &Element);
+	TEST_IS_EQ(TestJsonStreamRead(TEST_JSON_STREAM_CONTENT, 4, 0, json_CommentNone, &Edit, 1, Output, sizeof(Output), NULL), JSON_STREAM_ERROR, TestResult);
+	TEST_IS_EQ(Edit.State, json_EditNoPath, TestResult);
+
+	JsonEditSetUp(&Edit, JsonPathAscii("/a[/b:null]"), &Element);
+	TEST_IS_EQ(TestJsonStreamRead(TEST_JSON_STREAM_CONTENT, 4, 0, json_CommentNone, &Edit, 1, Output, sizeof(Output), NULL), JSON_STREAM_ERROR, TestResult);
+	TEST_IS_EQ(Edit.State, json_EditNoValue, TestResult);
+
+	JsonElementCleanUp(&Element);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStreamMemory(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static char Content[TEST_JSON_STREAM_KEYS * 32];
+	static char Output[TEST_JSON_STREAM_KEYS * 64];
+	tJsonElement Element;
+	tJsonEdit Edit;
+	size_t MaxCount;
+	size_t Length;
+	size_t Index;
+
+	Length = (size_t)snprintf(Content, sizeof(Content), "{");
+	for (Index = 0; Index < TEST_JSON_STREAM_KEYS; Index++)
+	{
+		Length = Length + (size_t)snprintf(&Content[Length], sizeof(Content) - Length, "%s\"k%zu\": [ %zu, { \"v\": \"x\" } ]", (Index == 0) ? " " : ", ", Index, Index);
+	}
+	snprintf(&Content[Length], sizeof(Content) - Length, " }");
+
+	TEST_IS_EQ(TestJsonStreamRead(Content, 64, 3, json_CommentLine, NULL, 0, Output, sizeof(Output), &MaxCount), JSON_STREAM_COMPLETE, TestResult);
+	TEST_IS_TRUE(MaxCount < 32, TestResult);
+
+	JsonElementSetUp(&Element);
+	TEST_IS_TRUE(JsonReadStringAscii(&Element, true, "[ 1, 2 ]"), TestResult);
+	JsonEditSetUp(&Edit, JsonPathAscii("/k500"), &Element);
+
+	TEST_IS_EQ(TestJsonStreamRead(Content, 64, 0, json_CommentNone, &Edit, 1, Output, sizeof(Output), &MaxCount), JSON_STREAM_COMPLETE, TestResult);
+	TEST_IS_EQ(Edit.State, json_EditApplied, TestResult);
+	TEST_IS_TRUE(MaxCount < 32, TestResult);
+	TEST_IS_NOT_NULL(strstr(Output, "\"k500\": [ 1, 2 ], \"k501\""), TestResult);
+
+	JsonElementCleanUp(&Element);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonStream[] =
+{
+	{ "JsonStreamSetUp",     TestJsonStreamSetUp     },
+	{ "JsonStreamFormat",    TestJsonStreamFormat    },
+	{ "JsonStreamEdit",      TestJsonStreamEdit      },
+	{ "JsonStreamEditError", TestJsonStreamEditError },
+	{ "JsonStreamMemory",    TestJsonStreamMemory    }
+};
+
+
+const tTest TestJsonStream =
+{
+	"JsonStream",
+	TestCaseJsonStream,
+	sizeof(TestCaseJsonStream) / sizeof(TestCaseJsonStream[0])
+};
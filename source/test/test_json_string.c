@@ -1,3 +1,5 @@
+#include <string.h>
+#include "json_arena.h"
 #include "json_string.h"
 #include "test_json.h"
 
@@ -22,6 +24,56 @@ static tTestResult TestJsonStringSetUp(void)
 }
 
 
+static tTestResult TestJsonStringSetUpAllocator(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonString String;
+	tJsonArena Arena;
+	tJsonAllocator Allocator;
+	tJsonCharacter Character;
+	tJsonCharacter NextCharacter;
+	size_t Offset;
+	size_t Length;
+
+	JsonArenaSetUp(&Arena, 64);
+
+	JsonArenaGetAllocator(&Arena, &Allocator);
+
+	JsonStringSetUpAllocator(&String, &Allocator);
+
+	TEST_IS_ZERO(JsonStringGetLength(&String), TestResult);
+
+	for (Character = 'a'; Character <= 'z'; Character++)
+	{
+		TEST_IS_TRUE(JsonStringAddCharacter(&String, Character), TestResult);
+		TEST_IS_TRUE(JsonStringAddCharacter(&String, 0x10000 + Character), TestResult);
+	}
+
+	TEST_IS_NOT_NULL(Arena.Chunk, TestResult);
+
+	for (Character = 'a', Offset = 0; Character <= 'z'; Character++, Offset = Offset + Length)
+	{
+		Length = JsonStringGetNextCharacter(&String, Offset, &NextCharacter);
+		TEST_IS_EQ(Length, 1, TestResult);
+		TEST_IS_EQ(NextCharacter, Character, TestResult);
+		Offset = Offset + Length;
+		Length = JsonStringGetNextCharacter(&String, Offset, &NextCharacter);
+		TEST_IS_EQ(Length, 4, TestResult);
+		TEST_IS_EQ(NextCharacter, 0x10000 + Character, TestResult);
+	}
+
+	TEST_IS_EQ(Offset, JsonStringGetLength(&String), TestResult);
+
+	JsonStringCleanUp(&String);
+
+	TEST_IS_ZERO(JsonStringGetLength(&String), TestResult);
+
+	JsonArenaCleanUp(&Arena);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonStringCleanUp(void)
 {
 	tTestResult TestResult = TEST_RESULT_INITIAL;
@@ -109,6 +161,125 @@ static tTestResult TestJsonStringGetLength(void)
 }
 
 
+static tTestResult TestJsonStringReserve(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonString String;
+	uint8_t *Content;
+	size_t n;
+
+	JsonStringSetUp(&String);
+
+	TEST_IS_ZERO(JsonStringGetCapacity(&String), TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 0), TestResult);
+
+	TEST_IS_FALSE(JsonStringReserve(&String, SIZE_MAX), TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 1000), TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), 1000, TestResult);
+
+	TEST_IS_ZERO(JsonStringGetLength(&String), TestResult);
+
+	Content = String.Content;
+
+	for (n = 0; n < 1000; n++)
+	{
+		TEST_IS_TRUE(JsonStringAddCharacter(&String, 'a'), TestResult);
+	}
+
+	TEST_IS_EQ(String.Content, Content, TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), 1000, TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 10), TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), 1000, TestResult);
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, 'b'), TestResult);
+
+	TEST_IS_TRUE(JsonStringGetCapacity(&String) > 1000, TestResult);
+
+	TEST_IS_EQ(JsonStringGetLength(&String), 1001, TestResult);
+
+	TEST_IS_EQ(String.Content[999], 'a', TestResult);
+
+	TEST_IS_EQ(String.Content[1000], 'b', TestResult);
+
+	TEST_IS_EQ(String.Content[1001], '\0', TestResult);
+
+	JsonStringCleanUp(&String);
+
+	TEST_IS_ZERO(JsonStringGetCapacity(&String), TestResult);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStringShrinkToFit(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonString String;
+
+	JsonStringSetUp(&String);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 100), TestResult);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_ZERO(JsonStringGetCapacity(&String), TestResult);
+
+	TEST_IS_NULL(String.Content, TestResult);
+
+	TEST_IS_TRUE(JsonStringAddBytes(&String, (const uint8_t *)"abc", 3), TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), JSON_STRING_INLINE_LENGTH, TestResult);
+
+	TEST_IS_EQ(String.Content, String.Inline, TestResult);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), JSON_STRING_INLINE_LENGTH, TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 100), TestResult);
+
+	TEST_IS_NOT_EQ(String.Content, String.Inline, TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "abc", 4), TestResult);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_EQ(String.Content, String.Inline, TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "abc", 4), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddBytes(&String, (const uint8_t *)"defghijklmnopqrstuvwxyz", 23), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, '0'), TestResult);
+
+	TEST_IS_TRUE(JsonStringGetCapacity(&String) > 27, TestResult);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_EQ(JsonStringGetCapacity(&String), 27, TestResult);
+
+	TEST_IS_EQ(JsonStringGetLength(&String), 27, TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "abcdefghijklmnopqrstuvwxyz0", 28), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, '1'), TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "abcdefghijklmnopqrstuvwxyz01", 29), TestResult);
+
+	JsonStringCleanUp(&String);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonStringAddCharacter(void)
 {
 	tTestResult TestResult = TEST_RESULT_INITIAL;
@@ -165,6 +336,132 @@ static tTestResult TestJsonStringAddCharacter(void)
 }
 
 
+static tTestResult TestJsonStringAddBytes(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Bytes[] = "0123456789\xC2\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+	tJsonString String;
+	size_t n;
+
+	JsonStringSetUp(&String);
+
+	TEST_IS_TRUE(JsonStringAddBytes(&String, Bytes, 0), TestResult);
+
+	TEST_IS_FALSE(JsonStringAddCharacter(&String, '\0'), TestResult);
+
+	TEST_IS_ZERO(JsonStringGetLength(&String), TestResult);
+
+	TEST_IS_NULL(String.Content, TestResult);
+
+	for (n = 0; n < 100; n++)
+	{
+		TEST_IS_TRUE(JsonStringAddBytes(&String, Bytes, sizeof(Bytes) - 1), TestResult);
+
+		TEST_IS_EQ(JsonStringGetLength(&String), (n + 1) * (sizeof(Bytes) - 1), TestResult);
+
+		TEST_IS_ZERO(memcmp(&String.Content[n * (sizeof(Bytes) - 1)], Bytes, sizeof(Bytes)), TestResult);
+	}
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, 'a'), TestResult);
+
+	TEST_IS_ZERO(memcmp(&String.Content[100 * (sizeof(Bytes) - 1)], "a", 2), TestResult);
+
+	JsonStringCleanUp(&String);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStringAddView(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Bytes[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+	tJsonString String;
+
+	JsonStringSetUp(&String);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 0), TestResult);
+
+	TEST_IS_NULL(String.Content, TestResult);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 10), TestResult);
+
+	TEST_IS_EQ(String.Content, Bytes, TestResult);
+
+	TEST_IS_EQ(JsonStringGetLength(&String), 10, TestResult);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, &Bytes[10], 20), TestResult);
+
+	TEST_IS_EQ(String.Content, Bytes, TestResult);
+
+	TEST_IS_EQ(JsonStringGetLength(&String), 30, TestResult);
+
+	TEST_IS_TRUE(JsonStringShrinkToFit(&String), TestResult);
+
+	TEST_IS_EQ(String.Content, Bytes, TestResult);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 6), TestResult);
+
+	TEST_IS_NOT_EQ(String.Content, Bytes, TestResult);
+
+	TEST_IS_EQ(JsonStringGetLength(&String), 36, TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "0123456789abcdefghijklmnopqrst012345", 37), TestResult);
+
+	JsonStringClear(&String);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 3), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, 'z'), TestResult);
+
+	TEST_IS_EQ(String.Content, String.Inline, TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "012z", 5), TestResult);
+
+	JsonStringCleanUp(&String);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonStringIsView(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const uint8_t Bytes[] = "abc";
+	tJsonString String;
+
+	JsonStringSetUp(&String);
+
+	TEST_IS_FALSE(JsonStringIsView(&String), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 3), TestResult);
+
+	TEST_IS_TRUE(JsonStringIsView(&String), TestResult);
+
+	TEST_IS_TRUE(JsonStringAddCharacter(&String, 'd'), TestResult);
+
+	TEST_IS_FALSE(JsonStringIsView(&String), TestResult);
+
+	JsonStringClear(&String);
+
+	TEST_IS_TRUE(JsonStringAddView(&String, Bytes, 3), TestResult);
+
+	TEST_IS_TRUE(JsonStringReserve(&String, 100), TestResult);
+
+	TEST_IS_FALSE(JsonStringIsView(&String), TestResult);
+
+	TEST_IS_ZERO(memcmp(String.Content, "abc", 4), TestResult);
+
+	JsonStringClear(&String);
+
+	TEST_IS_FALSE(JsonStringIsView(&String), TestResult);
+
+	JsonStringCleanUp(&String);
+
+	return TestResult;
+}
+
+
 static tTestResult TestJsonStringGetNextCharacter(void)
 {
 	tTestResult TestResult = TEST_RESULT_INITIAL;
@@ -216,10 +513,16 @@ static tTestResult TestJsonStringGetNextCharacter(void)
 static const tTestCase TestCaseJsonString[] =
 {
 	{ "JsonStringSetUp",            TestJsonStringSetUp            },
+	{ "JsonStringSetUpAllocator",   TestJsonStringSetUpAllocator   },
 	{ "JsonStringCleanUp",          TestJsonStringCleanUp          },
 	{ "JsonStringClear",            TestJsonStringClear            },
 	{ "JsonStringGetLength",        TestJsonStringGetLength        },
+	{ "JsonStringReserve",          TestJsonStringReserve          },
+	{ "JsonStringShrinkToFit",      TestJsonStringShrinkToFit      },
 	{ "JsonStringAddCharacter",     TestJsonStringAddCharacter     },
+	{ "JsonStringAddBytes",         TestJsonStringAddBytes         },
+	{ "JsonStringAddView",          TestJsonStringAddView          },
+	{ "JsonStringIsView",           TestJsonStringIsView           },
 	{ "JsonStringGetNextCharacter", TestJsonStringGetNextCharacter }
 };
 
@@ -0,0 +1,435 @@
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define TEST_JSON_PIPE
+#endif
+
+#include <string.h>
+#ifdef TEST_JSON_PIPE
+#include <unistd.h>
+#endif
+#include "json_tape.h"
+#include "json.h"
+#include "test_json.h"
+
+
+static const char *TestJsonTapeContent =
+	"{\"key1\": 123, // comment\n"
+	" \"key2\": \"hello world\",\n"
+	" \"key3\": [{\"object\": 1, \"key31\": \"hello again\"}, /* comment */ {\"object\": 2, \"key32\": [{\"object\": 321}, {\"object\": 322, \"key322\": true}]}, \"text\", [1, 2], []],\n"
+	" \"key4\": {},\n"
+	" \"key\\u00e9\": \"\\u00e9\\n\"}";
+
+
+static bool TestJsonTapeCompare(const tJsonTape *Tape, size_t Index, const tJsonElement *Element)
+{
+	const uint8_t *Name;
+	size_t Length;
+
+	if (Element == NULL)
+	{
+		return Index == JSON_TAPE_NONE;
+	}
+	else if (Index == JSON_TAPE_NONE)
+	{
+		return false;
+	}
+
+	Name = JsonTapeGetName(Tape, Index, &Length);
+
+	return (JsonTapeGetType(Tape, Index) == Element->Type) && (Length == Element->Name.Length) && ((Length == 0) || (memcmp(Name, Element->Name.Content, Length) == 0));
+}
+
+
+static bool TestJsonTapeCompareAll(const tJsonTape *Tape, size_t Index, const tJsonElement *Element)
+{
+	while ((Index != JSON_TAPE_NONE) || (Element != NULL))
+	{
+		if (!TestJsonTapeCompare(Tape, Index, Element) || !TestJsonTapeCompareAll(Tape, JsonTapeGetChild(Tape, Index, false), Element->Child))
+		{
+			return false;
+		}
+
+		Index = JsonTapeGetNext(Tape, Index, false);
+		Element = Element->Next;
+	}
+
+	return true;
+}
+
+
+static tTestResult TestJsonTapeSetUp(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonTape Tape;
+
+	JsonTapeSetUp(&Tape);
+
+	TEST_IS_NULL(Tape.Entry, TestResult);
+
+	TEST_IS_ZERO(Tape.Count, TestResult);
+
+	TEST_IS_NULL(Tape.Strings, TestResult);
+
+	TEST_IS_ZERO(Tape.StringsLength, TestResult);
+
+	TEST_IS_EQ(JsonTapeFind(&Tape, JsonPathAscii("/")), JSON_TAPE_NONE, TestResult);
+
+	JsonTapeCleanUp(&Tape);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonTapeFromElement(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonTape Tape;
+	size_t Index;
+
+	JsonElementSetUp(&Root);
+
+	JsonTapeSetUp(&Tape);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	TEST_IS_EQ(Tape.Count, 1, TestResult);
+
+	TEST_IS_EQ(Tape.Entry[0].End, 1, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetChild(&Tape, 0, false), JSON_TAPE_NONE, TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "[1, {\"a\": [true]}, 3] // end\n"), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	TEST_IS_EQ(Tape.Count, 9, TestResult);
+
+	TEST_IS_EQ(Tape.Entry[0].End, 9, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetType(&Tape, 1), json_TypeArray, TestResult);
+	TEST_IS_EQ(Tape.Entry[1].End, 8, TestResult);
+	TEST_IS_EQ(Tape.Entry[1].Next, 8, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetType(&Tape, 3), json_TypeObject, TestResult);
+	TEST_IS_EQ(Tape.Entry[3].End, 7, TestResult);
+	TEST_IS_EQ(Tape.Entry[3].Next, 7, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetType(&Tape, 4), json_TypeKey, TestResult);
+	TEST_IS_EQ(Tape.Entry[4].End, 7, TestResult);
+	TEST_IS_EQ(Tape.Entry[4].Next, JSON_TAPE_NONE, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetType(&Tape, 8), json_TypeComment, TestResult);
+	TEST_IS_EQ(Tape.Entry[8].Next, JSON_TAPE_NONE, TestResult);
+
+	Index = JsonTapeGetChild(&Tape, 1, true);
+	TEST_IS_EQ(Index, 2, TestResult);
+
+	Index = JsonTapeGetNext(&Tape, Index, true);
+	TEST_IS_EQ(Index, 3, TestResult);
+
+	Index = JsonTapeGetNext(&Tape, Index, true);
+	TEST_IS_EQ(Index, 7, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetNext(&Tape, Index, true), JSON_TAPE_NONE, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetNext(&Tape, 1, true), JSON_TAPE_NONE, TestResult);
+
+	TEST_IS_EQ(JsonTapeGetNext(&Tape, 1, false), 8, TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child), TestResult);
+
+	TEST_IS_FALSE(JsonTapeFromElement(&Tape, Root.Child), TestResult);
+
+	TEST_IS_ZERO(Tape.Count, TestResult);
+
+	JsonTapeCleanUp(&Tape);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonTapeToElement(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonElement CopyRoot;
+	tJsonTape Tape;
+	tJsonTape CopyTape;
+
+	JsonElementSetUp(&Root);
+
+	JsonElementSetUpArena(&CopyRoot, 0);
+
+	JsonTapeSetUp(&Tape);
+
+	JsonTapeSetUp(&CopyTape);
+
+	TEST_IS_FALSE(JsonTapeToElement(&Tape, &CopyRoot), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	TEST_IS_TRUE(JsonTapeToElement(&Tape, &CopyRoot), TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), CopyRoot.Child), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&CopyTape, &CopyRoot), TestResult);
+
+	TEST_IS_EQ(CopyTape.Count, Tape.Count, TestResult);
+
+	TEST_IS_ZERO(memcmp(CopyTape.Entry, Tape.Entry, Tape.Count * sizeof(tJsonTapeEntry)), TestResult);
+
+	TEST_IS_EQ(CopyTape.StringsLength, Tape.StringsLength, TestResult);
+
+	TEST_IS_ZERO(memcmp(CopyTape.Strings, Tape.Strings, Tape.StringsLength), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, "[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]], 2]"), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	TEST_IS_TRUE(JsonTapeToElement(&Tape, &CopyRoot), TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), CopyRoot.Child), TestResult);
+
+	JsonTapeCleanUp(&CopyTape);
+
+	JsonTapeCleanUp(&Tape);
+
+	JsonElementCleanUp(&CopyRoot);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonTapeReadStringUtf8(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonElement Root;
+	tJsonTape Tape;
+
+	JsonElementSetUp(&Root);
+
+	JsonTapeSetUp(&Tape);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(JsonTapeReadStringUtf8(&Tape, false, (const uint8_t *)TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child), TestResult);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, true, TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(JsonTapeReadStringUtf8(&Tape, true, (const uint8_t *)TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child), TestResult);
+
+	TEST_IS_FALSE(JsonTapeReadStringUtf8(&Tape, false, (const uint8_t *)"{\"key\": }"), TestResult);
+
+	TEST_IS_ZERO(Tape.Count, TestResult);
+
+	JsonTapeCleanUp(&Tape);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static const char *TestJsonTapeComments =
+	"// leading\n"
+	"{\"a\" /* c1 */ : /* c2 */ 1 /* c3 */ , /* c4 */ \"b\": {\"x\": 1} // c5\n"
+	", \"c\": [1 /* c6 */, 2, \"a longer string value\"] /* c7 */, \"d\": 1234567890, \"e\": {\"f\": {\"g\": []}}} // c8\n";
+
+
+static FILE *TestJsonTapeOpen(const char *Content, bool Pipe)
+{
+	FILE *File = NULL;
+#ifdef TEST_JSON_PIPE
+	int Descriptor[2];
+
+	if (Pipe)
+	{
+		if (pipe(Descriptor) == 0)
+		{
+			if (write(Descriptor[1], Content, strlen(Content)) == (ssize_t)strlen(Content))
+			{
+				File = fdopen(Descriptor[0], "r");
+			}
+			close(Descriptor[1]);
+			if (File == NULL)
+			{
+				close(Descriptor[0]);
+			}
+		}
+		return File;
+	}
+#endif
+
+	File = tmpfile();
+	if ((File != NULL) && ((fputs(Content, File) < 0) || (fseek(File, 0, SEEK_SET) != 0)))
+	{
+		fclose(File);
+		File = NULL;
+	}
+
+	return File;
+}
+
+
+static tTestResult TestJsonTapeReadFile(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	const char *Content[] = { TestJsonTapeComments, "[1, \"two\", {\"three\": 3}]", "\"text\"", "-1.5e3", "{\"key\": }" };
+	size_t BufferSize[] = { 4, 7, 1024 };
+	tJsonElement Root;
+	tJsonTape Tape;
+	FILE *File;
+	size_t n;
+	size_t m;
+	int Pipe;
+	int Strip;
+	bool ok;
+
+	JsonElementSetUp(&Root);
+
+	JsonTapeSetUp(&Tape);
+
+	for (n = 0; n < sizeof(Content) / sizeof(Content[0]); n++)
+	{
+		for (Strip = 0; Strip < 2; Strip++)
+		{
+			ok = JsonReadStringAscii(&Root, Strip != 0, Content[n]);
+
+			TEST_IS_TRUE(ok == (n + 1 < sizeof(Content) / sizeof(Content[0])), TestResult);
+
+			TEST_IS_TRUE(JsonTapeReadStringUtf8(&Tape, Strip != 0, (const uint8_t *)Content[n]) == ok, TestResult);
+
+			TEST_IS_TRUE(!ok || TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child), TestResult);
+
+			for (Pipe = 0; Pipe < 2; Pipe++)
+			{
+				for (m = 0; m < sizeof(BufferSize) / sizeof(BufferSize[0]); m++)
+				{
+					File = TestJsonTapeOpen(Content[n], Pipe != 0);
+
+					TEST_IS_NOT_NULL(File, TestResult);
+
+					if (File != NULL)
+					{
+						TEST_IS_TRUE(JsonTapeReadFile(&Tape, Strip != 0, File, BufferSize[m]) == ok, TestResult);
+
+						TEST_IS_TRUE(ok ? TestJsonTapeCompareAll(&Tape, JsonTapeGetChild(&Tape, 0, false), Root.Child) : (Tape.Count == 0), TestResult);
+
+						fclose(File);
+					}
+				}
+			}
+		}
+	}
+
+	JsonTapeCleanUp(&Tape);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonTapeFind(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const char *Paths[] =
+	{
+		"/",
+		"/key1",
+		"/key1:123",
+		"/key1:124",
+		"/\"key\\u0031\":123",
+		"/key2:\"hello world\"",
+		"/key2:hello world",
+		"/key3[/object:1]",
+		"/key3[/object:1]/key31:\"hello again\"",
+		"/key3[/object:2]/key32[/object:322]/key322:true",
+		"/key3[/object:2]/key32[/object:323]",
+		"/key3[/object:2]/key31",
+		"/key3[:\"text\"]",
+		"/key3[:text]",
+		"/key3[[:1]]",
+		"/key3[[:2]]",
+		"/key3[[:3]]",
+		"/key3[]",
+		"/key3[#0]",
+		"/key3[#1]/key32[#-1]/key322",
+		"/key3[#-1]",
+		"/key3[#-1][#0]",
+		"/key3[#-2][#1]",
+		"/key3[#-2][#1]:2",
+		"/key3[#100]",
+		"/key3[#-100]",
+		"/key4/",
+		"/key4/key",
+		"/key\\u00e9:\"\\u00e9\\n\"",
+		"key1",
+		"/key1/key2",
+		"/key3/object",
+		"",
+		"[",
+	};
+	tJsonElement Root;
+	tJsonTape Tape;
+	size_t n;
+
+	JsonElementSetUp(&Root);
+
+	JsonTapeSetUp(&Tape);
+
+	TEST_IS_TRUE(JsonReadStringAscii(&Root, false, TestJsonTapeContent), TestResult);
+
+	TEST_IS_TRUE(JsonTapeFromElement(&Tape, &Root), TestResult);
+
+	for (n = 0; n < sizeof(Paths) / sizeof(Paths[0]); n++)
+	{
+		TEST_IS_TRUE(TestJsonTapeCompare(&Tape, JsonTapeFind(&Tape, JsonPathAscii(Paths[n])), JsonElementFind(&Root, JsonPathAscii(Paths[n]), false)), TestResult);
+	}
+
+	TEST_IS_EQ(JsonTapeGetType(&Tape, JsonTapeFind(&Tape, JsonPathAscii("/key3[/object:2]/key32[/object:322]/key322:true"))), json_TypeValueLiteral, TestResult);
+
+	TEST_IS_EQ(JsonTapeFind(&Tape, JsonPathAscii("/key3[/object:3]")), JSON_TAPE_NONE, TestResult);
+
+	JsonTapeCleanUp(&Tape);
+
+	JsonElementCleanUp(&Root);
+
+	return TestResult;
+}
+
+
+static const tTestCase TestCaseJsonTape[] =
+{
+	{ "JsonTapeSetUp",          TestJsonTapeSetUp          },
+	{ "JsonTapeFromElement",    TestJsonTapeFromElement    },
+	{ "JsonTapeToElement",      TestJsonTapeToElement      },
+	{ "JsonTapeReadStringUtf8", TestJsonTapeReadStringUtf8 },
+	{ "JsonTapeReadFile",       TestJsonTapeReadFile       },
+	{ "JsonTapeFind",           TestJsonTapeFind           }
+};
+
+
+const tTest TestJsonTape =
+{
+	"JsonTape",
+	TestCaseJsonTape,
+	sizeof(TestCaseJsonTape) / sizeof(TestCaseJsonTape[0])
+};
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "json_utf8.h"
 #include "test_json.h"
 
@@ -290,11 +291,141 @@ static tTestResult TestJsonUtf8DecodePrevious(void)
 }
 
 
+static tTestResult TestJsonUtf8DecodeNextTrusted(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonCharacter Character;
+	tJsonCharacter DecodeCharacter;
+	tJsonUtf8 Utf8;
+	size_t Length;
+
+	for (Character = 0; Character < 0x110000; Character++)
+	{
+		Length = JsonUtf8Encode(Utf8, sizeof(Utf8), 0, Character);
+		if (Length != 0)
+		{
+			TEST_IS_EQ(JsonUtf8DecodeNextTrusted(Utf8, 0, &DecodeCharacter), Length, TestResult);
+			TEST_IS_EQ(DecodeCharacter, Character, TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static bool TestJsonUtf8ValidateReference(const uint8_t *Content, size_t Length)
+{
+	tJsonCharacter Character;
+	size_t DecodeLength;
+	size_t n;
+
+	for (n = 0; n < Length; n = n + DecodeLength)
+	{
+		DecodeLength = JsonUtf8DecodeNext(Content, Length, n, &Character);
+		if (DecodeLength == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+static tTestResult TestJsonUtf8Validate(void)
+{
+	static const uint8_t Third[] = { 0x00, 0x41, 0x7F, 0x80, 0x9F, 0xA0, 0xBF, 0xC0, 0xF4, 0xFF };
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	tJsonCharacter Character;
+	uint8_t Content[80];
+	size_t Offset;
+	size_t Length;
+	size_t n;
+
+	TEST_IS_TRUE(JsonUtf8Validate((const uint8_t *)"", 0), TestResult);
+
+	for (Offset = 29; Offset < 33; Offset++)
+	{
+		for (Character = 0x80; Character < 0x110000; Character++)
+		{
+			memset(Content, 'a', sizeof(Content));
+			Length = JsonUtf8Encode(Content, sizeof(Content), Offset, Character);
+			if (Length != 0)
+			{
+				TEST_IS_TRUE(JsonUtf8Validate(Content, sizeof(Content)), TestResult);
+				TEST_IS_TRUE(JsonUtf8Validate(Content, Offset + Length), TestResult);
+				TEST_IS_FALSE(JsonUtf8Validate(Content, Offset + Length - 1), TestResult);
+			}
+		}
+	}
+
+	for (Offset = 0; Offset < 40; Offset = Offset + 3)
+	{
+		for (n = 0; n < 0x10000; n++)
+		{
+			memset(Content, 'a', sizeof(Content));
+			Content[Offset] = (uint8_t)(n >> 8);
+			Content[Offset + 1] = (uint8_t)n;
+			TEST_IS_EQ(JsonUtf8Validate(Content, sizeof(Content)), TestJsonUtf8ValidateReference(Content, sizeof(Content)), TestResult);
+			TEST_IS_EQ(JsonUtf8Validate(Content, Offset + 2), TestJsonUtf8ValidateReference(Content, Offset + 2), TestResult);
+		}
+	}
+
+	for (Offset = 29; Offset < 33; Offset++)
+	{
+		for (n = 0; n < 0x10000 * sizeof(Third); n++)
+		{
+			memset(Content, 'a', sizeof(Content));
+			Content[Offset] = (uint8_t)(n >> 8);
+			Content[Offset + 1] = (uint8_t)n;
+			Content[Offset + 2] = Third[n / 0x10000];
+			Content[Offset + 3] = 0x80;
+			TEST_IS_EQ(JsonUtf8Validate(Content, sizeof(Content)), TestJsonUtf8ValidateReference(Content, sizeof(Content)), TestResult);
+		}
+	}
+
+	return TestResult;
+}
+
+
+static tTestResult TestJsonUtf8GetCompleteLength(void)
+{
+	tTestResult TestResult = TEST_RESULT_INITIAL;
+	static const tJsonCharacter Characters[] = { 'a', 0xA9, 0x20AC, 0x1F600 };
+	uint8_t Content[8];
+	size_t Length;
+	size_t n;
+	size_t m;
+
+	TEST_IS_ZERO(JsonUtf8GetCompleteLength((const uint8_t *)"", 0), TestResult);
+
+	for (n = 0; n < sizeof(Characters) / sizeof(Characters[0]); n++)
+	{
+		Content[0] = 'a';
+		Length = 1 + JsonUtf8Encode(Content, sizeof(Content), 1, Characters[n]);
+
+		TEST_IS_EQ(JsonUtf8GetCompleteLength(Content, Length), Length, TestResult);
+
+		for (m = 2; m < Length; m++)
+		{
+			TEST_IS_EQ(JsonUtf8GetCompleteLength(Content, m), 1, TestResult);
+		}
+	}
+
+	TEST_IS_EQ(JsonUtf8GetCompleteLength((const uint8_t *)"a\x80\x80\x80\x80", 5), 5, TestResult);
+
+	return TestResult;
+}
+
+
 static const tTestCase TestCaseJsonUtf8[] =
 {
-	{ "JsonUtf8Encode",         TestJsonUtf8Encode         },
-	{ "JsonUtf8DecodeNext",     TestJsonUtf8DecodeNext     },
-	{ "JsonUtf8DecodePrevious", TestJsonUtf8DecodePrevious }
+	{ "JsonUtf8Encode",            TestJsonUtf8Encode            },
+	{ "JsonUtf8DecodeNext",        TestJsonUtf8DecodeNext        },
+	{ "JsonUtf8DecodeNextTrusted", TestJsonUtf8DecodeNextTrusted },
+	{ "JsonUtf8DecodePrevious",    TestJsonUtf8DecodePrevious    },
+	{ "JsonUtf8Validate",          TestJsonUtf8Validate          },
+	{ "JsonUtf8GetCompleteLength", TestJsonUtf8GetCompleteLength }
 };
 
 